@@ -0,0 +1,5 @@
+#ifndef SIM_GENERICTYPEDEFS_H
+#define SIM_GENERICTYPEDEFS_H
+// GenericTypeDefs.h (simulation hors cible) : voir sim_hal.h
+#include "sim_hal.h"
+#endif
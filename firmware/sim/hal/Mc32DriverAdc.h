@@ -0,0 +1,5 @@
+#ifndef SIM_MC32DRIVERADC_H
+#define SIM_MC32DRIVERADC_H
+// Mc32DriverAdc.h (simulation hors cible) : voir sim_hal.h
+#include "sim_hal.h"
+#endif
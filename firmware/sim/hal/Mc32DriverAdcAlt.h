@@ -0,0 +1,5 @@
+#ifndef SIM_MC32DRIVERADCALT_H
+#define SIM_MC32DRIVERADCALT_H
+// Mc32DriverAdcAlt.h (simulation hors cible) : voir sim_hal.h
+#include "sim_hal.h"
+#endif
@@ -0,0 +1,5 @@
+#ifndef SIM_MC32DRIVERLCD_H
+#define SIM_MC32DRIVERLCD_H
+// Mc32DriverLcd.h (simulation hors cible) : voir sim_hal.h
+#include "sim_hal.h"
+#endif
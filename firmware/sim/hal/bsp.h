@@ -0,0 +1,5 @@
+#ifndef SIM_BSP_H
+#define SIM_BSP_H
+// bsp.h (simulation hors cible) : voir sim_hal.h
+#include "sim_hal.h"
+#endif
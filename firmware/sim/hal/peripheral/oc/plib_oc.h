@@ -0,0 +1,5 @@
+#ifndef SIM_PERIPHERAL_OC_PLIB_OC_H
+#define SIM_PERIPHERAL_OC_PLIB_OC_H
+// plib_oc.h (simulation hors cible) : voir sim_hal.h
+#include "../../sim_hal.h"
+#endif
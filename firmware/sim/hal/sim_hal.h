@@ -0,0 +1,234 @@
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+/*--------------------------------------------------------*/
+// sim_hal.h
+/*--------------------------------------------------------*/
+//	Description :	HAL simulé pour la compilation hors cible
+//			        (PC Linux) de l'application TP2 PWM&RS232
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.0
+//	Compilateur	:	gcc / clang (C99)
+//
+//  Remplace les en-têtes Harmony / BSP (xc.h, bsp.h, plib, LCD,
+//  ADC) : les sources de firmware/src sont compilées telles
+//  quelles contre ce HAL.
+//
+//  Modèles :
+//   - contrôleur d'interruptions : flag + enable par source, les
+//     routines d'interruption sont appelées par SIM_IntDispatch()
+//     (pas de préemption, appel entre deux fonctions de l'appli)
+//   - USART1 : fifo HW de 8 octets en RX et en TX, seuil RX,
+//     overrun, ligne série cadencée au débit (SIM_Avance)
+//   - ADC : 2 canaux fixés par SIM_AdcSet() ; avec ADC_DMA, une
+//     conversion toutes les ADC_DMA_PERIODE_NS copiée par le DMA
+//     simulé, interruption du canal DMA 3 par bloc
+//   - OC / timers : largeur d'impulsion mémorisée par OC
+//   - LCD : 4 lignes de 20 caractères
+//   - LED, RTS / CTS, pont en H : variables
+//
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Les attributs d'interruption disparaissent, les routines
+// deviennent des fonctions appelées par le simulateur
+#define __ISR(vecteur, ipl)
+
+#define SYS_CLK_FREQ                80000000ul
+#define SYS_CLK_BUS_PERIPHERAL_1    80000000ul
+
+/*--------------------------------------------------------*/
+// Contrôleur d'interruptions
+/*--------------------------------------------------------*/
+typedef enum { INT_ID_0 = 0 } INT_MODULE_ID;
+
+typedef enum
+{
+    INT_SOURCE_TIMER_1 = 0,
+    INT_SOURCE_TIMER_2,
+    INT_SOURCE_TIMER_3,
+    INT_SOURCE_USART_1_ERROR,
+    INT_SOURCE_USART_1_RECEIVE,
+    INT_SOURCE_USART_1_TRANSMIT,
+    INT_SOURCE_DMA_1,
+    INT_SOURCE_DMA_3,
+    SIM_NB_INT_SOURCES,
+} INT_SOURCE;
+
+typedef enum { INT_VECTOR_T1 = 0, INT_VECTOR_UART1, INT_VECTOR_DMA1, INT_VECTOR_DMA3 } INT_VECTOR;
+typedef enum
+{
+    INT_DISABLE_INTERRUPT = 0,
+    INT_PRIORITY_LEVEL3 = 3,
+    INT_PRIORITY_LEVEL4 = 4,
+    INT_PRIORITY_LEVEL5 = 5,
+} INT_PRIORITY_LEVEL;
+typedef enum { INT_SUBPRIORITY_LEVEL0 = 0 } INT_SUBPRIORITY_LEVEL;
+
+bool PLIB_INT_SourceFlagGet(INT_MODULE_ID id, INT_SOURCE source);
+void PLIB_INT_SourceFlagSet(INT_MODULE_ID id, INT_SOURCE source);
+void PLIB_INT_SourceFlagClear(INT_MODULE_ID id, INT_SOURCE source);
+bool PLIB_INT_SourceIsEnabled(INT_MODULE_ID id, INT_SOURCE source);
+void PLIB_INT_SourceEnable(INT_MODULE_ID id, INT_SOURCE source);
+void PLIB_INT_SourceDisable(INT_MODULE_ID id, INT_SOURCE source);
+void PLIB_INT_VectorPrioritySet(INT_MODULE_ID id, INT_VECTOR vecteur, INT_PRIORITY_LEVEL prio);
+void PLIB_INT_VectorSubPrioritySet(INT_MODULE_ID id, INT_VECTOR vecteur, INT_SUBPRIORITY_LEVEL sousPrio);
+
+/*--------------------------------------------------------*/
+// USART1
+/*--------------------------------------------------------*/
+typedef enum { USART_ID_1 = 0 } USART_MODULE_ID;
+
+typedef enum
+{
+    USART_ERROR_NONE = 0,
+    USART_ERROR_RECEIVER_OVERRUN = 1,
+    USART_ERROR_FRAMING = 2,
+    USART_ERROR_PARITY = 4,
+} USART_ERROR;
+
+typedef enum
+{
+    USART_RECEIVE_FIFO_ONE_CHAR = 0,
+    USART_RECEIVE_FIFO_HALF_FULL,
+    USART_RECEIVE_FIFO_3B4FULL,
+} USART_RECEIVE_INTR_MODE;
+
+bool PLIB_USART_ReceiverDataIsAvailable(USART_MODULE_ID id);
+uint8_t PLIB_USART_ReceiverByteReceive(USART_MODULE_ID id);
+bool PLIB_USART_ReceiverIsIdle(USART_MODULE_ID id);
+USART_ERROR PLIB_USART_ErrorsGet(USART_MODULE_ID id);
+void PLIB_USART_ReceiverOverrunErrorClear(USART_MODULE_ID id);
+void PLIB_USART_ReceiverInterruptModeSelect(USART_MODULE_ID id, USART_RECEIVE_INTR_MODE mode);
+bool PLIB_USART_TransmitterBufferIsFull(USART_MODULE_ID id);
+bool PLIB_USART_TransmitterIsEmpty(USART_MODULE_ID id);
+void PLIB_USART_TransmitterByteSend(USART_MODULE_ID id, uint8_t data);
+
+typedef enum
+{
+    DRV_USART_BAUD_SET_SUCCESS = 0,
+    DRV_USART_BAUD_SET_ERROR = -1,
+} DRV_USART_BAUD_SET_RESULT;
+
+// Change le débit de la ligne simulée (les deux côtés)
+DRV_USART_BAUD_SET_RESULT DRV_USART0_BaudSet(uint32_t baud);
+
+/*--------------------------------------------------------*/
+// Timers, OC, ports
+/*--------------------------------------------------------*/
+typedef enum { TMR_ID_1 = 0, TMR_ID_2, TMR_ID_3 } TMR_MODULE_ID;
+typedef enum { OC_ID_1 = 0, OC_ID_2, OC_ID_3, OC_ID_4, SIM_NB_OC } OC_MODULE_ID;
+typedef enum { PORTS_ID_0 = 0 } PORTS_MODULE_ID;
+typedef enum { PORT_CHANNEL_C = 0 } PORTS_CHANNEL;
+
+#define AIN1_HBRIDGE_PORT PORT_CHANNEL_C
+#define AIN1_HBRIDGE_BIT 1
+#define AIN2_HBRIDGE_PORT PORT_CHANNEL_C
+#define AIN2_HBRIDGE_BIT 2
+
+uint16_t PLIB_TMR_Counter16BitGet(TMR_MODULE_ID id);
+void PLIB_OC_PulseWidth16BitSet(OC_MODULE_ID id, uint16_t largeur);
+void PLIB_PORTS_PinSet(PORTS_MODULE_ID id, PORTS_CHANNEL port, uint8_t bit);
+void PLIB_PORTS_PinClear(PORTS_MODULE_ID id, PORTS_CHANNEL port, uint8_t bit);
+
+bool DRV_TMR0_Start(void);
+bool DRV_TMR1_Start(void);
+bool DRV_TMR2_Start(void);
+uint32_t DRV_TMR1_PeriodValueGet(void);
+void DRV_OC0_Start(void);
+void DRV_OC1_Start(void);
+
+/*--------------------------------------------------------*/
+// BSP : LED, RS232, pont en H, ADC, LCD
+/*--------------------------------------------------------*/
+typedef enum
+{
+    BSP_LED_0 = 0, BSP_LED_1, BSP_LED_2, BSP_LED_3,
+    BSP_LED_4, BSP_LED_5, BSP_LED_6, BSP_LED_7,
+} BSP_LED;
+
+extern uint8_t SimLed[8];
+extern uint8_t SimRts;      // sortie RTS de la carte
+extern uint8_t SimCts;      // entrée CTS de la carte (0 = émission autorisée)
+
+#define LED3_W SimLed[3]
+#define LED3_R SimLed[3]
+#define LED4_W SimLed[4]
+#define LED4_R SimLed[4]
+#define LED5_W SimLed[5]
+#define LED5_R SimLed[5]
+#define RS232_RTS SimRts
+#define RS232_CTS SimCts
+
+void BSP_LEDOn(BSP_LED led);
+void BSP_LEDOff(BSP_LED led);
+void BSP_LEDToggle(BSP_LED led);
+void BSP_EnableHbrige(void);
+
+typedef struct
+{
+    uint16_t Chan0;
+    uint16_t Chan1;
+} S_ADCResultsAlt;
+
+void BSP_InitADC10Alt(void);
+S_ADCResultsAlt BSP_ReadADCAlt(void);
+
+void lcd_init(void);
+void lcd_bl_on(void);
+void lcd_gotoxy(uint8_t x, uint8_t y);
+void lcd_ClearLine(uint8_t ligne);
+void printf_lcd(const char *format, ...);
+
+/*--------------------------------------------------------*/
+// Pilotage du simulateur
+/*--------------------------------------------------------*/
+
+#define SIM_LCD_LIGNES 4
+#define SIM_LCD_COLONNES 20
+#define SIM_UART_FIFO_HW 8
+
+// Etat visible de la carte simulée
+extern char SimLcd[SIM_LCD_LIGNES][SIM_LCD_COLONNES + 1];
+extern uint16_t SimOcLargeur[SIM_NB_OC];
+extern uint8_t SimAin1, SimAin2;        // sens du pont en H
+extern uint32_t SimUartNbrOverrun;      // octets perdus dans le fifo HW RX
+extern uint32_t SimNbrIntUart;          // entrées dans l'interruption USART
+extern uint32_t SimDebit;               // débit de la ligne (bauds)
+
+// Sortie de la ligne TX : appelée pour chaque octet émis par la carte
+typedef void (*SIM_SortieTx)(uint8_t octet, void *pContexte);
+
+// Remise à zéro du HAL, débit de la ligne en bauds
+void SIM_Init(uint32_t baud);
+void SIM_SortieTxSet(SIM_SortieTx pSortie, void *pContexte);
+
+// Octets envoyés à la carte par le partenaire (émis au débit de la
+// ligne tant que la carte autorise, RTS = 0)
+void SIM_UartEnvoie(const uint8_t *pData, uint32_t nbChar);
+uint32_t SIM_UartAEnvoyer(void);
+
+// Valeurs ADC (0..1023)
+void SIM_AdcSet(uint16_t chan0, uint16_t chan1);
+
+// Tick du timer 1 (20 ms) : équivalent de IntHandlerDrvTmrInstance0
+void SIM_Tick(void);
+
+// Avance le temps simulé : ligne série, fifos HW, interruptions
+void SIM_Avance(uint32_t dureeNs);
+// Appelle les routines d'interruption en attente
+void SIM_IntDispatch(void);
+// Temps simulé écoulé
+uint64_t SIM_TempsNs(void);
+
+// Routines d'interruption de l'application (Mc32gest_RS232.c)
+void _IntHandlerDrvUsartInstance0(void);
+void _IntHandlerDmaUartTx(void);
+// Routine d'interruption du DMA de l'ADC (gestPWM.c)
+void _IntHandlerDmaAdc(void);
+
+#endif
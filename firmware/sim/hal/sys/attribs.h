@@ -0,0 +1,5 @@
+#ifndef SIM_SYS_ATTRIBS_H
+#define SIM_SYS_ATTRIBS_H
+// attribs.h (simulation hors cible) : voir sim_hal.h
+#include "../sim_hal.h"
+#endif
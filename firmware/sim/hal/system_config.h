@@ -0,0 +1,5 @@
+#ifndef SIM_SYSTEM_CONFIG_H
+#define SIM_SYSTEM_CONFIG_H
+// system_config.h (simulation hors cible) : voir sim_hal.h
+#include "sim_hal.h"
+#endif
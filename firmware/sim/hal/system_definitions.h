@@ -0,0 +1,5 @@
+#ifndef SIM_SYSTEM_DEFINITIONS_H
+#define SIM_SYSTEM_DEFINITIONS_H
+// system_definitions.h (simulation hors cible) : voir sim_hal.h
+#include "sim_hal.h"
+#endif
@@ -0,0 +1,5 @@
+#ifndef SIM_XC_H
+#define SIM_XC_H
+// xc.h (simulation hors cible) : voir sim_hal.h
+#include "sim_hal.h"
+#endif
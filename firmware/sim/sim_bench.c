@@ -0,0 +1,370 @@
+// sim_bench.c
+// Mesures de débit et de latence du protocole RS232 sur la simulation
+// CFO 17.10.2026 création
+// CFO 17.10.2026 tramage COBS (RS232_COBS)
+// CFO 17.10.2026 générateur commun (sim_test.h)
+//
+// Usage : tp2_bench [-b bauds,...] [-f trames/s,...] [-e ber,...]
+//                   [-t secondes] [-s graine] [-j] [-H]
+//   -b : débits de la ligne (57600 par défaut)
+//   -f : cadence d'envoi des consignes par le PC (50 par défaut)
+//   -e : taux d'erreur binaire injecté sur la ligne PC -> carte (0)
+//   -t : durée simulée de chaque point après l'initialisation (10 s)
+//   -s : graine du générateur d'erreurs
+//   -j : sortie JSON (un objet par ligne) au lieu de CSV
+//   -H : sans ligne d'en-tête CSV
+//
+// Chaque combinaison des listes est un point de mesure, exécuté dans
+// un processus fils (l'application garde son état dans des statiques).
+// Les tailles de fifo sont fixées à la compilation (FIFO_RX_SIZE,
+// FIFO_TX_SIZE) : 'make bench' construit une variante par taille.
+//
+// Les consignes envoyées sont toutes différentes (vitesse et angle
+// dérivés du numéro de trame) : la consigne appliquée par la carte
+// identifie la trame et donne la latence, de la fin de la trame sur
+// la ligne à la mise à jour des largeurs d'impulsion (OC2, OC3).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "sim_hal.h"
+#include "app.h"
+#include "Mc32gest_RS232.h"
+#include "Mc32CalCrc16.h"
+#include "Mc32Cobs.h"
+#include "sim_test.h"
+
+#define BENCH_TICK_NS 20000000u
+#define BENCH_PAS_NS 1000000u
+#define BENCH_CYCLES_INIT (COMPTEUR_3_SECONDES + 1)
+#define BENCH_LISTE_MAX 16
+// Nombre de consignes différentes (199 vitesses x 181 angles)
+#define BENCH_NB_CONSIGNES (199 * 181)
+
+extern S_pwmSettings PWMData;
+
+typedef struct
+{
+    uint32_t baud;
+    uint32_t tramesParS;
+    double ber;
+} S_benchPoint;
+
+typedef struct
+{
+    uint32_t envoyees;
+    uint32_t appliquees;
+    uint64_t latenceSommeNs;
+    uint64_t latenceMaxNs;
+    uint32_t trameTxValides;
+    uint8_t fenetreTx[5];
+    uint8_t nbFenetreTx;
+    int8_t trameTx[V2_TAILLE_MAX];
+    S_cobsDecodeur cobsTx;
+} S_benchResultat;
+
+static S_benchResultat res;
+static uint64_t *pFinTrame;     // fin de chaque trame sur la ligne
+static uint32_t derniereAppliquee;
+static uint64_t graineErreur = 1;    // tirages des erreurs de bit
+
+
+// Consigne de la trame n
+static void BenchConsigne(uint32_t n, int8_t *pSpeed, int8_t *pAngle)
+{
+    uint32_t k = n % BENCH_NB_CONSIGNES;
+
+    *pSpeed = (int8_t)((k % 199) - 99);
+    *pAngle = (int8_t)((k / 199) - 90);
+}
+
+// Numéro de la dernière trame envoyée portant la consigne appliquée
+static int32_t BenchTrameAppliquee(int8_t speed, int8_t angle)
+{
+    uint32_t k = (uint32_t)(angle + 90) * 199 + (uint32_t)(speed + 99);
+    uint32_t n;
+
+    if (res.envoyees == 0)
+    {
+        return -1;
+    }
+    n = res.envoyees - 1;
+    n -= (n + BENCH_NB_CONSIGNES - k) % BENCH_NB_CONSIGNES;
+    return (n <= res.envoyees - 1) ? (int32_t)n : -1;
+}
+
+// Octets émis par la carte : comptage des trames valides
+static void BenchSortie(uint8_t octet, void *pContexte)
+{
+    (void)pContexte;
+#if RS232_COBS
+    if ((COBS_DecodeOctet(&res.cobsTx, (int8_t)octet) == COBS_TRAME) &&
+        (res.cobsTx.nb == 5) && ((uint8_t)res.trameTx[0] == 0xAA) &&
+        (crc16_ccitt((const uint8_t *)res.trameTx, 3, 0xFFFF) ==
+         (((uint8_t)res.trameTx[3] << 8) | (uint8_t)res.trameTx[4])))
+    {
+        res.trameTxValides++;
+    }
+    return;
+#endif
+    if (res.nbFenetreTx < 5)
+    {
+        res.fenetreTx[res.nbFenetreTx++] = octet;
+    }
+    else
+    {
+        memmove(res.fenetreTx, &res.fenetreTx[1], 4);
+        res.fenetreTx[4] = octet;
+    }
+    if ((res.nbFenetreTx == 5) && (res.fenetreTx[0] == 0xAA) &&
+        (crc16_ccitt(res.fenetreTx, 3, 0xFFFF) ==
+         ((res.fenetreTx[3] << 8) | res.fenetreTx[4])))
+    {
+        res.trameTxValides++;
+        res.nbFenetreTx = 0;
+    }
+}
+
+// Trame de consigne envoyée par le PC, erreurs binaires injectées
+static void BenchEnvoieTrame(const S_benchPoint *pPoint, uint32_t dureeOctetNs)
+{
+    uint8_t trame[COBS_TAILLE_ENCODEE(5) + 1];
+    uint8_t nb = 5;
+    uint16_t crc;
+    int8_t speed, angle;
+    uint8_t i, b;
+
+    BenchConsigne(res.envoyees, &speed, &angle);
+    trame[0] = 0xAA;
+    trame[1] = (uint8_t)speed;
+    trame[2] = (uint8_t)angle;
+    crc = crc16_ccitt(trame, 3, 0xFFFF);
+    trame[3] = crc >> 8;
+    trame[4] = crc & 0xFF;
+#if RS232_COBS
+    {
+        int8_t brut[5];
+
+        memcpy(brut, trame, 5);
+        nb = COBS_Encode(brut, 5, (int8_t *)trame);
+        trame[nb++] = COBS_DELIMITEUR;
+    }
+#endif
+    // erreurs sur les octets de la ligne
+    if (pPoint->ber > 0)
+    {
+        for (i = 0; i < nb; i++)
+        {
+            for (b = 0; b < 8; b++)
+            {
+                if (SIM_AleaReel(&graineErreur) < pPoint->ber)
+                {
+                    trame[i] ^= 1 << b;
+                }
+            }
+        }
+    }
+    SIM_UartEnvoie(trame, nb);
+    pFinTrame[res.envoyees] = SIM_TempsNs() + (uint64_t)SIM_UartAEnvoyer() * dureeOctetNs;
+    res.envoyees++;
+}
+
+// Consigne appliquée par la carte après un cycle
+static void BenchControle(void)
+{
+    int32_t n = BenchTrameAppliquee(PWMData.SpeedSetting, PWMData.AngleSetting);
+    uint64_t latence;
+
+    if ((n < 0) || ((uint32_t)n + 1 <= derniereAppliquee) ||
+        (SIM_TempsNs() < pFinTrame[n]))
+    {
+        return;
+    }
+    derniereAppliquee = n + 1;
+    latence = SIM_TempsNs() - pFinTrame[n];
+    res.appliquees++;
+    res.latenceSommeNs += latence;
+    if (latence > res.latenceMaxNs)
+    {
+        res.latenceMaxNs = latence;
+    }
+}
+
+static void BenchCycle(void)
+{
+    SIM_Tick();
+    APP_Tasks();
+}
+
+// Un point de mesure (dans le processus fils)
+static void BenchPoint(const S_benchPoint *pPoint, uint32_t dureeS, uint8_t json)
+{
+    uint32_t dureeOctetNs = (uint32_t)(10000000000ull / pPoint->baud);
+    uint64_t periodeNs = 1000000000ull / pPoint->tramesParS;
+    uint64_t prochaineNs, finNs, tempsNs;
+    uint32_t c, pas;
+    double dureeMesure;
+
+    memset(&res, 0, sizeof(res));
+    COBS_DecodeInit(&res.cobsTx, res.trameTx, V2_TAILLE_MAX);
+    derniereAppliquee = 0;
+    pFinTrame = calloc((size_t)dureeS * pPoint->tramesParS + 16, sizeof(uint64_t));
+
+    SIM_Init(pPoint->baud);
+    SIM_AdcSet(512, 512);
+    SIM_SortieTxSet(BenchSortie, NULL);
+    APP_Initialize();
+    for (c = 0; c < BENCH_CYCLES_INIT; c++)
+    {
+        BenchCycle();
+        SIM_Avance(BENCH_TICK_NS);
+    }
+    res.trameTxValides = 0;
+
+    prochaineNs = SIM_TempsNs();
+    finNs = SIM_TempsNs() + (uint64_t)dureeS * 1000000000ull;
+    while (SIM_TempsNs() < finNs)
+    {
+        BenchCycle();
+        BenchControle();
+        for (pas = 0; pas < BENCH_TICK_NS / BENCH_PAS_NS; pas++)
+        {
+            tempsNs = SIM_TempsNs();
+            while ((prochaineNs <= tempsNs) && (tempsNs < finNs))
+            {
+                BenchEnvoieTrame(pPoint, dureeOctetNs);
+                prochaineNs += periodeNs;
+            }
+            SIM_Avance(BENCH_PAS_NS);
+        }
+    }
+
+    dureeMesure = dureeS;
+    if (json)
+    {
+        printf("{\"fifo_rx\": %u, \"fifo_tx\": %u, \"baud\": %u, \"trames_s\": %u, "
+               "\"ber\": %g, \"envoyees\": %u, \"appliquees\": %u, \"remplacees\": %u, "
+               "\"crc_err\": %u, \"overrun\": %u, \"int_uart\": %u, "
+               "\"lat_moy_ms\": %.3f, \"lat_max_ms\": %.3f, \"tx_trames_s\": %.2f}\n",
+               descrFifoRX.size, descrFifoTX.size, pPoint->baud, pPoint->tramesParS,
+               pPoint->ber, res.envoyees, res.appliquees, NbrMessRemplaces,
+               NbrErreursCrc, SimUartNbrOverrun, SimNbrIntUart,
+               res.appliquees ? res.latenceSommeNs / 1e6 / res.appliquees : 0.0,
+               res.latenceMaxNs / 1e6, res.trameTxValides / dureeMesure);
+    }
+    else
+    {
+        printf("%u,%u,%u,%u,%g,%u,%u,%u,%u,%u,%u,%.3f,%.3f,%.2f\n",
+               descrFifoRX.size, descrFifoTX.size, pPoint->baud, pPoint->tramesParS,
+               pPoint->ber, res.envoyees, res.appliquees, NbrMessRemplaces,
+               NbrErreursCrc, SimUartNbrOverrun, SimNbrIntUart,
+               res.appliquees ? res.latenceSommeNs / 1e6 / res.appliquees : 0.0,
+               res.latenceMaxNs / 1e6, res.trameTxValides / dureeMesure);
+    }
+    fflush(stdout);
+    free(pFinTrame);
+}
+
+// Liste de valeurs séparées par des virgules
+static uint8_t BenchListe(const char *pTexte, double *pValeurs)
+{
+    uint8_t nb = 0;
+    char *pFin;
+
+    while ((*pTexte != '\0') && (nb < BENCH_LISTE_MAX))
+    {
+        pValeurs[nb++] = strtod(pTexte, &pFin);
+        if (pFin == pTexte)
+        {
+            return 0;
+        }
+        pTexte = (*pFin == ',') ? pFin + 1 : pFin;
+    }
+    return nb;
+}
+
+int main(int argc, char *argv[])
+{
+    double bauds[BENCH_LISTE_MAX] = { 57600 };
+    double cadences[BENCH_LISTE_MAX] = { 50 };
+    double bers[BENCH_LISTE_MAX] = { 0 };
+    uint8_t nbBauds = 1, nbCadences = 1, nbBers = 1;
+    uint32_t dureeS = 10;
+    uint64_t graine = 1;
+    uint8_t json = 0, entete = 1;
+    uint8_t ib, ic, ie;
+    S_benchPoint point;
+    int opt, statut;
+    pid_t pid;
+
+    while ((opt = getopt(argc, argv, "b:f:e:t:s:jH")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b':
+                nbBauds = BenchListe(optarg, bauds);
+                break;
+            case 'f':
+                nbCadences = BenchListe(optarg, cadences);
+                break;
+            case 'e':
+                nbBers = BenchListe(optarg, bers);
+                break;
+            case 't':
+                dureeS = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                graine = strtoull(optarg, NULL, 0);
+                break;
+            case 'j':
+                json = 1;
+                break;
+            case 'H':
+                entete = 0;
+                break;
+            default:
+                nbBauds = 0;
+                break;
+        }
+    }
+    if ((nbBauds == 0) || (nbCadences == 0) || (nbBers == 0) || (dureeS == 0))
+    {
+        fprintf(stderr, "usage: %s [-b bauds,...] [-f trames/s,...] [-e ber,...] "
+                "[-t secondes] [-s graine] [-j] [-H]\n", argv[0]);
+        return 2;
+    }
+
+    if (entete && !json)
+    {
+        printf("fifo_rx,fifo_tx,baud,trames_s,ber,envoyees,appliquees,remplacees,"
+               "crc_err,overrun,int_uart,lat_moy_ms,lat_max_ms,tx_trames_s\n");
+        fflush(stdout);
+    }
+    for (ib = 0; ib < nbBauds; ib++)
+    {
+        for (ic = 0; ic < nbCadences; ic++)
+        {
+            for (ie = 0; ie < nbBers; ie++)
+            {
+                point.baud = (uint32_t)bauds[ib];
+                point.tramesParS = (uint32_t)cadences[ic];
+                point.ber = bers[ie];
+                if ((point.baud == 0) || (point.tramesParS == 0))
+                {
+                    continue;
+                }
+                pid = fork();
+                if (pid == 0)
+                {
+                    graineErreur = SIM_AleaGraine(graine);
+                    BenchPoint(&point, dureeS, json);
+                    _exit(0);
+                }
+                waitpid(pid, &statut, 0);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,130 @@
+// sim_conv_test.c
+// Vérification des conversions en virgule fixe (Mc32ConvPwm) sur PC
+// CFO 17.10.2026 création
+// CFO 17.10.2026 vérifications communes (sim_test.h)
+//
+// Usage : tp2_test_conv
+//
+// Chaque conversion est comparée à la formule entière d'origine de
+// gestPWM.c sur tout son domaine :
+//   vitesse = (198 * adc) / 1023          adc 0..1023
+//   angle   = (180 * adc) / 1023          adc 0..1023
+//   OC2     = (|vitesse| * période) / 100 |vitesse| 0..99, toutes les
+//                                         périodes 16 bits du timer 2
+//   OC3     = ((angle + 90) * 9000) / 180 + 2999   angle -90..90
+//                                         (calibration par défaut)
+// puis la sauvegarde de la calibration du servo (page de flash
+// simulée de Mc32Nvm) : écrite seulement par CONV_CalibSauve, rechargée
+// par CONV_Init, ignorée si refusée ou si la page est corrompue.
+// Un changement de Facteur ou de CONV_Q_ADC / CONV_Q_OC qui modifie un
+// seul arrondi est signalé. Code de sortie 0 si tout est identique.
+
+#include "Mc32ConvPwm.h"
+#include "Mc32Nvm.h"
+#include "sim_test.h"
+
+// Période maximale du timer 2 (16 bits)
+#define CONV_TEST_PERIODE_MAX 65535
+
+static void Verifie(const char *pNom, uint32_t entree, uint32_t periode,
+                    uint32_t obtenu, uint32_t attendu)
+{
+    SIM_Verifie(obtenu == attendu, "%s entree=%u periode=%u : %u au lieu de %u",
+                pNom, entree, periode, obtenu, attendu);
+}
+
+// Table OC3 et calibration active contre la calibration attendue
+static void VerifieCalib(const char *pNom, const S_convCalib *pCalib)
+{
+    const S_convCalib *pActive = CONV_CalibGet();
+    int32_t i, attendu;
+
+    Verifie(pNom, 0, 0, pActive->oc3Min, pCalib->oc3Min);
+    Verifie(pNom, 1, 0, pActive->oc3Max, pCalib->oc3Max);
+    Verifie(pNom, 2, 0, (uint16_t)pActive->oc3Courbure, (uint16_t)pCalib->oc3Courbure);
+    for (i = 0; i < CONV_NB_ANGLES; i++)
+    {
+        attendu = pCalib->oc3Min + ((pCalib->oc3Max - pCalib->oc3Min) * i) / 180
+                  + (pCalib->oc3Courbure * i * (180 - i)) / 8100;
+        Verifie(pNom, i, 0, CONV_AngleOc3(i - CONV_ANGLE_MAX), attendu);
+    }
+}
+
+static void TestSauvegarde(void)
+{
+    static const S_convCalib defaut = { CONV_OC3_MIN_DEFAUT, CONV_OC3_MAX_DEFAUT, 0 };
+    static const S_convCalib calib = { 3500, 11000, -250 };
+    static const S_convCalib refusee = { 100, 40000, 0 };
+
+    // carte neuve : défaut
+    NVM_SimEfface();
+    CONV_Init(0);
+    VerifieCalib("calib neuve", &defaut);
+
+    // nouvelle calibration appliquée en RAM seulement
+    Verifie("calib set", 0, 0, CONV_CalibSet(&calib), 0);
+    VerifieCalib("calib set", &calib);
+    CONV_Init(0);
+    VerifieCalib("calib non sauvee", &defaut);
+
+    // sauvegarde explicite puis rechargée au redémarrage
+    Verifie("calib set", 0, 0, CONV_CalibSet(&calib), 0);
+    Verifie("calib sauve", 0, 0, CONV_CalibSauve(), 0);
+    CONV_Init(0);
+    VerifieCalib("calib rechargee", &calib);
+
+    // flash déjà à jour : pas d'effacement (octet libre de la page
+    // programmé à 0, remis à 0xFF par un effacement)
+    NVM_SimPage()[NVM_PAGE_TAILLE - 1] = 0x00;
+    Verifie("calib sauve", 0, 0, CONV_CalibSauve(), 0);
+    Verifie("calib sans effacement", 0, 0, NVM_SimPage()[NVM_PAGE_TAILLE - 1], 0x00);
+
+    // calibration refusée : ni appliquée ni sauvegardée
+    Verifie("calib refusee", 0, 0, CONV_CalibSet(&refusee), 1);
+    Verifie("calib sauve", 0, 0, CONV_CalibSauve(), 0);
+    CONV_Init(0);
+    VerifieCalib("calib refusee", &calib);
+
+    // page corrompue : défaut
+    NVM_SimPage()[8] ^= 0x01;
+    CONV_Init(0);
+    VerifieCalib("calib corrompue", &defaut);
+    NVM_SimEfface();
+}
+
+int main(void)
+{
+    uint32_t adc, periode, vitesse;
+    int32_t angle;
+
+    NVM_SimEfface();
+    CONV_Init(0);
+
+    for (adc = 0; adc <= CONV_ADC_MAX; adc++)
+    {
+        Verifie("vitesse", adc, 0, CONV_AdcVitesse(adc),
+                (2 * CONV_VITESSE_MAX * adc) / CONV_ADC_MAX);
+        Verifie("angle", adc, 0, CONV_AdcAngle(adc),
+                (2 * CONV_ANGLE_MAX * adc) / CONV_ADC_MAX);
+    }
+
+    for (periode = 0; periode <= CONV_TEST_PERIODE_MAX; periode++)
+    {
+        CONV_PeriodeSet(periode);
+        for (vitesse = 0; vitesse <= CONV_VITESSE_MAX; vitesse++)
+        {
+            Verifie("oc2", vitesse, periode, CONV_VitesseOc2(vitesse),
+                    (vitesse * periode) / 100);
+        }
+    }
+
+    for (angle = -CONV_ANGLE_MAX; angle <= CONV_ANGLE_MAX; angle++)
+    {
+        Verifie("oc3", angle + CONV_ANGLE_MAX, 0, CONV_AngleOc3(angle),
+                (((angle + 90) * 9000) / 180) + 2999);
+    }
+
+    TestSauvegarde();
+
+    return SIM_Bilan("conv");
+}
@@ -0,0 +1,156 @@
+// sim_crc_bench.c
+// Coût par octet du calcul CRC16 (Mc32CalCrc16) sur PC
+// CFO 17.10.2026 création
+//
+// La variante de crc16_ccitt est fixée à la compilation (CRC16_SLICE,
+// CRC16_TABLE_NIBBLE) : 'make bench-crc' construit une variante par
+// option de CRC_VARIANTES, puis mesure le modèle du générateur DMA.
+//
+// Usage : tp2_bench_crc [-m table|dma] [-l tailles] [-o octets] [-r repetitions] [-H]
+//   -m : backend mesuré, crc16_ccitt (table, défaut) ou modèle du
+//        générateur CRC du DMA (dma)
+//   -l : tailles de buffer, séparées par des virgules (5,64,1024 par défaut)
+//   -o : octets traités par passe (4194304 par défaut)
+//   -r : nombre de passes, la plus rapide est retenue (5 par défaut)
+//   -H : sans ligne d'en-tête
+//
+// Une ligne CSV par taille :
+//   backend, slice, quartet, taille : variante et taille du buffer
+//   ns_octet     : durée par octet (passe la plus rapide)
+//   cycles_octet : cycles du compteur TSC par octet (x86, 0 sinon)
+//   mo_s         : débit en Mo/s
+// Le modèle DMA est un registre à décalage bit à bit : sa mesure donne
+// le coût de la simulation, pas celui du générateur de la cible.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "Mc32CalCrc16.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LIT_CYCLES() __rdtsc()
+#else
+#define LIT_CYCLES() 0ull
+#endif
+
+#define BENCH_TAILLES_MAX 16
+#define BENCH_TAILLE_MAX 65536
+
+static uint64_t TempsNs(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+
+int main(int argc, char *argv[])
+{
+    static uint8_t buf[BENCH_TAILLE_MAX];
+    uint32_t tailles[BENCH_TAILLES_MAX] = { 5, 64, 1024 };
+    uint32_t nbTailles = 3;
+    uint32_t nbOctets = 1u << 22;
+    uint32_t nbPasses = 5;
+    int entete = 1;
+    int dma = 0;
+    char *pTaille;
+    uint64_t t0, c0, ns, cycles, nsMin, cyclesMin;
+    uint32_t i, t, p, n, nbAppels;
+    volatile uint16_t puits = 0;
+    uint16_t crc;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "m:l:o:r:H")) != -1)
+    {
+        switch (opt)
+        {
+            case 'm':
+                dma = (strcmp(optarg, "dma") == 0);
+                break;
+            case 'l':
+                nbTailles = 0;
+                for (pTaille = strtok(optarg, ","); (pTaille != NULL) &&
+                     (nbTailles < BENCH_TAILLES_MAX); pTaille = strtok(NULL, ","))
+                {
+                    tailles[nbTailles++] = strtoul(pTaille, NULL, 0);
+                }
+                break;
+            case 'o':
+                nbOctets = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                nbPasses = strtoul(optarg, NULL, 0);
+                break;
+            case 'H':
+                entete = 0;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-m table|dma] [-l tailles] "
+                        "[-o octets] [-r repetitions] [-H]\n", argv[0]);
+                return 2;
+        }
+    }
+    for (t = 0; t < nbTailles; t++)
+    {
+        if ((tailles[t] == 0) || (tailles[t] > BENCH_TAILLE_MAX))
+        {
+            fprintf(stderr, "taille 1..%u\n", BENCH_TAILLE_MAX);
+            return 2;
+        }
+    }
+    if (nbPasses == 0)
+    {
+        fprintf(stderr, "-r > 0\n");
+        return 2;
+    }
+
+    for (i = 0; i < sizeof(buf); i++)
+    {
+        buf[i] = (uint8_t)(i * 131 + 7);
+    }
+    CRC16_SelectBackend(dma ? &CRC16_BackendDma : &CRC16_BackendTable);
+
+    if (entete)
+    {
+        printf("backend,slice,quartet,taille,ns_octet,cycles_octet,mo_s\n");
+    }
+    for (t = 0; t < nbTailles; t++)
+    {
+        nbAppels = nbOctets / tailles[t];
+        nbAppels = nbAppels ? nbAppels : 1;
+        nsMin = UINT64_MAX;
+        cyclesMin = UINT64_MAX;
+        for (p = 0; p < nbPasses; p++)
+        {
+            crc = 0xFFFF;
+            t0 = TempsNs();
+            c0 = LIT_CYCLES();
+            for (n = 0; n < nbAppels; n++)
+            {
+                // CRC chaîné : chaque appel dépend du précédent
+                crc = CRC16_Compute(buf, tailles[t], crc);
+            }
+            cycles = LIT_CYCLES() - c0;
+            ns = TempsNs() - t0;
+            puits = crc;
+            nsMin = (ns < nsMin) ? ns : nsMin;
+            cyclesMin = (cycles < cyclesMin) ? cycles : cyclesMin;
+        }
+        n = nbAppels * tailles[t];
+        if (dma)
+        {
+            printf("dma_modele,-,-,");
+        }
+        else
+        {
+            printf("table,%u,%u,", CRC16_SLICE, CRC16_TABLE_NIBBLE);
+        }
+        printf("%u,%.3f,%.2f,%.1f\n", tailles[t], (double)nsMin / n,
+               (double)cyclesMin / n, nsMin ? n * 1e3 / nsMin : 0.0);
+    }
+    (void)puits;
+    return 0;
+}
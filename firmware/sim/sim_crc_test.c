@@ -0,0 +1,320 @@
+// sim_crc_test.c
+// Vérification des backends CRC16 (Mc32CalCrc16) sur PC
+// CFO 17.10.2026 création
+// CFO 17.10.2026 vérifications et générateur communs (sim_test.h)
+//
+// Usage : tp2_test_crc [-s graine]
+//
+// Les tables générées à la compilation (par octet, par quartet, tables
+// de slice-by-4/8) sont comparées à la table de référence d'origine de
+// 512 octets, crc16_ccitt et updateCRC16 sont vérifiés sur les valeurs
+// connues du CRC16-CCITT puis contre un calcul octet par octet avec la
+// table de référence, à toutes les longueurs et tous les alignements.
+// La variante (CRC16_SLICE, CRC16_TABLE_NIBBLE) est fixée à la
+// compilation : 'make test-crc' construit une variante par CRC_VARIANTES.
+//
+// Le modèle du générateur CRC du DMA (CRC16_BackendDma) est comparé à
+// crc16_ccitt sur des buffers aléatoires de 0 à CRC_TEST_LEN_MAX
+// octets (plusieurs blocs DMA de 256 octets) et plusieurs valeurs
+// initiales, en calcul synchrone (Compute) et en calcul lancé puis
+// récupéré par appels cycliques (CRC16_Lance, CRC16_Termine).
+// Code de sortie 0 si toutes les vérifications passent.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "Mc32CalCrc16.h"
+#include "sim_test.h"
+
+#define CRC_TEST_LEN_MAX 1100
+#define CRC_TEST_BLOC_DMA 256
+
+// Tables générées par Mc32CalCrc16.c (non déclarées dans l'en-tête)
+#if CRC16_TABLE_NIBBLE
+extern const uint16_t CRC16_nibble[16];
+#else
+extern const uint16_t CRC16_table[256];
+#endif
+#if CRC16_SLICE > 1
+extern const uint16_t CRC16_slice[CRC16_SLICE - 1][256];
+#endif
+
+// Table d'origine de Mc32CalCrc16.c (Polynome 0x1021)
+static const uint16_t tableRef[256] = {
+   0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+   0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+   0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
+   0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
+   0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485,
+   0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
+   0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4,
+   0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
+   0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823,
+   0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
+   0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12,
+   0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
+   0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41,
+   0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
+   0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70,
+   0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
+   0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f,
+   0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
+   0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e,
+   0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
+   0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
+   0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+   0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c,
+   0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
+   0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab,
+   0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3,
+   0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a,
+   0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92,
+   0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9,
+   0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1,
+   0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8,
+   0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0
+};
+
+// Valeurs connues du CRC16-CCITT (polynôme 0x1021, non réfléchi),
+// message "123456789"
+typedef struct {
+    uint16_t init;
+    uint16_t crc;
+} S_vecteurCrc;
+
+static const S_vecteurCrc vecteurs[] = {
+    { 0xFFFF, 0x29B1 },     // CCITT-FALSE (protocole TP2)
+    { 0x0000, 0x31C3 },     // XMODEM
+    { 0x1D0F, 0xE5CC },     // AUG-CCITT
+};
+
+static uint64_t graine = 1;
+
+// Contrôle d'un CRC, message avec la longueur et la valeur initiale
+static void Verifie(int ok, const char *pNom, size_t len, uint16_t init,
+                    uint16_t obtenu, uint16_t attendu)
+{
+    SIM_Verifie(ok, "%s len=%zu init=0x%04X : 0x%04X au lieu de 0x%04X",
+                pNom, len, init, obtenu, attendu);
+}
+
+// Calcul octet par octet avec la table d'origine (updateCRC16 d'origine)
+static uint16_t CrcReference(const uint8_t *pData, size_t len, uint16_t init)
+{
+    uint16_t crc = init;
+
+    while (len > 0)
+    {
+        crc = tableRef[((crc >> 8) & 0xFF) ^ *pData] ^ (crc << 8);
+        pData++;
+        len--;
+    }
+    return crc;
+}
+
+// Tables générées contre la table d'origine. L'entrée x de la table de
+// slice k est l'entrée x de la table d'origine suivie de k octets nuls.
+static void TestTables(void)
+{
+    uint16_t attendu;
+    uint32_t x;
+#if CRC16_SLICE > 1
+    uint32_t k, j;
+#endif
+
+    for (x = 0; x < 256; x++)
+    {
+#if CRC16_TABLE_NIBBLE
+        if (x < 16)
+        {
+            Verifie(CRC16_nibble[x] == tableRef[x], "table quartet", x, 0,
+                    CRC16_nibble[x], tableRef[x]);
+        }
+#else
+        Verifie(CRC16_table[x] == tableRef[x], "table octet", x, 0,
+                CRC16_table[x], tableRef[x]);
+#endif
+#if CRC16_SLICE > 1
+        for (k = 1; k < CRC16_SLICE; k++)
+        {
+            attendu = tableRef[x];
+            for (j = 0; j < k; j++)
+            {
+                attendu = tableRef[attendu >> 8] ^ (uint16_t)(attendu << 8);
+            }
+            Verifie(CRC16_slice[k - 1][x] == attendu, "table slice", x, k,
+                    CRC16_slice[k - 1][x], attendu);
+        }
+#else
+        (void)attendu;
+#endif
+    }
+}
+
+static void TestVecteurs(void)
+{
+    static const uint8_t message[] = "123456789";
+    uint16_t crc;
+    uint8_t i, j;
+
+    for (i = 0; i < sizeof(vecteurs) / sizeof(vecteurs[0]); i++)
+    {
+        crc = crc16_ccitt(message, 9, vecteurs[i].init);
+        Verifie(crc == vecteurs[i].crc, "vecteur crc16_ccitt", 9,
+                vecteurs[i].init, crc, vecteurs[i].crc);
+        crc = vecteurs[i].init;
+        for (j = 0; j < 9; j++)
+        {
+            crc = updateCRC16(crc, message[j]);
+        }
+        Verifie(crc == vecteurs[i].crc, "vecteur updateCRC16", 9,
+                vecteurs[i].init, crc, vecteurs[i].crc);
+        crc = CrcReference(message, 9, vecteurs[i].init);
+        Verifie(crc == vecteurs[i].crc, "vecteur reference", 9,
+                vecteurs[i].init, crc, vecteurs[i].crc);
+    }
+    // message vide : la valeur initiale
+    crc = crc16_ccitt(message, 0, 0xFFFF);
+    Verifie(crc == 0xFFFF, "vecteur vide", 0, 0xFFFF, crc, 0xFFFF);
+}
+
+// crc16_ccitt et updateCRC16 contre la référence, toutes longueurs,
+// décalages 0..7 (pas de slice non aligné) et valeurs initiales
+static void TestReference(const uint8_t *pBuf)
+{
+    uint16_t crc, crcRef, init;
+    size_t len, decalage;
+
+    for (decalage = 0; decalage < 8; decalage++)
+    {
+        for (len = 0; len + decalage <= CRC_TEST_LEN_MAX; len++)
+        {
+            init = (uint16_t)SIM_Alea32(&graine);
+            crcRef = CrcReference(pBuf + decalage, len, init);
+            crc = crc16_ccitt(pBuf + decalage, len, init);
+            Verifie(crc == crcRef, "crc16_ccitt", len, init, crc, crcRef);
+            if (len > 0)
+            {
+                crc = updateCRC16(init, pBuf[decalage]);
+                crcRef = CrcReference(pBuf + decalage, 1, init);
+                Verifie(crc == crcRef, "updateCRC16", 1, init, crc, crcRef);
+            }
+        }
+    }
+}
+
+// Calcul lancé puis récupéré, retourne le nombre d'appels de Termine
+static uint32_t CalculLance(const uint8_t *pData, size_t len, uint16_t init,
+                            uint16_t *pCrc)
+{
+    uint32_t nbAppels = 0;
+
+    if (CRC16_Lance(pData, len, init) != 0)
+    {
+        return 0;
+    }
+    do
+    {
+        nbAppels++;
+    } while ((CRC16_Termine(pCrc) == 0) && (nbAppels < 1000));
+    return nbAppels;
+}
+
+static void TestBackendDma(const uint8_t *pBuf)
+{
+    static const uint16_t inits[] = { 0xFFFF, 0x0000, 0x1D0F, 0x84CF };
+    uint16_t crc, crcRef, crcOccupe, init;
+    uint32_t nbAppels, nbAppelsAttendu;
+    size_t len;
+    uint8_t i;
+
+    CRC16_SelectBackend(&CRC16_BackendDma);
+    for (len = 0; len <= CRC_TEST_LEN_MAX; len++)
+    {
+        for (i = 0; i < sizeof(inits) / sizeof(inits[0]) + 1; i++)
+        {
+            init = (i < sizeof(inits) / sizeof(inits[0])) ? inits[i] :
+                   (uint16_t)SIM_Alea32(&graine);
+            crcRef = crc16_ccitt(pBuf, len, init);
+
+            crc = CRC16_Compute(pBuf, len, init);
+            Verifie(crc == crcRef, "dma compute", len, init, crc, crcRef);
+
+            // un appel de Termine par bloc de message, plus le complément
+            crc = 0;
+            nbAppels = CalculLance(pBuf, len, init, &crc);
+            nbAppelsAttendu = (len + CRC_TEST_BLOC_DMA - 1) / CRC_TEST_BLOC_DMA + 1;
+            Verifie(crc == crcRef, "dma lance", len, init, crc, crcRef);
+            Verifie(nbAppels == nbAppelsAttendu, "dma nb appels", len, init,
+                    nbAppels, nbAppelsAttendu);
+        }
+    }
+
+    // générateur occupé : Lance refusé, Compute par tables, le calcul en
+    // cours n'est pas perturbé
+    len = 3 * CRC_TEST_BLOC_DMA;
+    crcRef = crc16_ccitt(pBuf, len, 0xFFFF);
+    Verifie(CRC16_Lance(pBuf, len, 0xFFFF) == 0, "dma lance libre", len, 0xFFFF, 1, 0);
+    Verifie(CRC16_Termine(&crc) == 0, "dma en cours", len, 0xFFFF, 1, 0);
+    Verifie(CRC16_Lance(pBuf, 5, 0xFFFF) == 1, "dma lance occupe", 5, 0xFFFF, 0, 1);
+    crcOccupe = CRC16_Compute(pBuf + 1, 17, 0x1234);
+    Verifie(crcOccupe == crc16_ccitt(pBuf + 1, 17, 0x1234), "dma compute occupe",
+            17, 0x1234, crcOccupe, crc16_ccitt(pBuf + 1, 17, 0x1234));
+    while (CRC16_Termine(&crc) == 0)
+    {
+    }
+    Verifie(crc == crcRef, "dma apres occupe", len, 0xFFFF, crc, crcRef);
+    Verifie(CRC16_Termine(&crc) == 0, "dma libre", len, 0xFFFF, 1, 0);
+}
+
+static void TestBackendTable(const uint8_t *pBuf)
+{
+    uint16_t crc, crcRef;
+    size_t len;
+
+    CRC16_SelectBackend(&CRC16_BackendTable);
+    for (len = 0; len <= CRC_TEST_LEN_MAX; len += 7)
+    {
+        crcRef = crc16_ccitt(pBuf, len, 0xFFFF);
+        crc = CRC16_Compute(pBuf, len, 0xFFFF);
+        Verifie(crc == crcRef, "table compute", len, 0xFFFF, crc, crcRef);
+        crc = 0;
+        Verifie(CalculLance(pBuf, len, 0xFFFF, &crc) == 1, "table nb appels",
+                len, 0xFFFF, 0, 1);
+        Verifie(crc == crcRef, "table lance", len, 0xFFFF, crc, crcRef);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    uint8_t buf[CRC_TEST_LEN_MAX];
+    char nom[32];
+    uint32_t i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                graine = SIM_AleaGraine(strtoull(optarg, NULL, 0));
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-s graine]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    for (i = 0; i < sizeof(buf); i++)
+    {
+        buf[i] = (uint8_t)SIM_Alea32(&graine);
+    }
+    TestTables();
+    TestVecteurs();
+    TestReference(buf);
+    TestBackendDma(buf);
+    TestBackendTable(buf);
+
+    snprintf(nom, sizeof(nom), "crc slice=%u nibble=%u", CRC16_SLICE, CRC16_TABLE_NIBBLE);
+    return SIM_Bilan(nom);
+}
@@ -0,0 +1,167 @@
+// sim_filtre_bench.c
+// Coût par échantillon de la chaîne de filtres ADC (Mc32Filtre)
+// CFO 17.10.2026 création
+// CFO 17.10.2026 générateur commun (sim_test.h)
+//
+// La chaîne est fixée à la compilation (FILTRE_MEDIANE, FILTRE_CIC_ORDRE,
+// FILTRE_CIC_LOG2_R, FILTRE_MOY_LOG2, FILTRE_EMA_K) : 'make bench-filtre'
+// construit une variante par chaîne de FILTRE_CHAINES.
+//
+// Usage : tp2_bench_filtre [-n echantillons] [-r repetitions] [-s graine] [-H]
+//   -n : échantillons par passe (1048576 par défaut)
+//   -r : nombre de passes, la plus rapide est retenue (5 par défaut)
+//   -s : graine du bruit
+//   -H : sans ligne d'en-tête
+//
+// Signal : potentiomètre fixe à mi-course (512) + bruit uniforme ±8
+// LSB + 1 % de pointes à 0 ou 1023. Une ligne CSV par exécution :
+//   mediane, cic_ordre, cic_r, moy, ema_k : chaîne
+//   ns_ech     : durée par échantillon (passe la plus rapide)
+//   cycles_ech : cycles du compteur TSC par échantillon (x86, 0 sinon)
+//   sorties    : valeurs produites par échantillon (décimation)
+//   pp_entree, pp_sortie : crête à crête de l'entrée et de la sortie,
+//                après la mise en régime (gigue de la consigne)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "Mc32Filtre.h"
+#include "sim_test.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LIT_CYCLES() __rdtsc()
+#else
+#define LIT_CYCLES() 0ull
+#endif
+
+#define BENCH_CENTRE 512
+#define BENCH_BRUIT 8
+#define BENCH_ADC_MAX 1023
+// Echantillons ignorés pour la crête à crête (mise en régime)
+#define BENCH_REGIME 4096
+
+static uint64_t graine = 1;
+
+static uint64_t TempsNs(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t nbEch = 1u << 20;
+    uint32_t nbPasses = 5;
+    int entete = 1;
+    uint16_t *pEch;
+    S_filtreCanal canal;
+    uint64_t t0, c0, ns, cycles;
+    uint64_t nsMin = UINT64_MAX, cyclesMin = UINT64_MAX;
+    uint32_t i, p, nbSorties = 0;
+    uint16_t minE = 0xFFFF, maxE = 0, minS = 0xFFFF, maxS = 0, v;
+    volatile uint16_t puits;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:r:s:H")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                nbEch = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                nbPasses = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                graine = SIM_AleaGraine(strtoull(optarg, NULL, 0));
+                break;
+            case 'H':
+                entete = 0;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n echantillons] [-r repetitions] "
+                        "[-s graine] [-H]\n", argv[0]);
+                return 2;
+        }
+    }
+    if ((nbEch <= BENCH_REGIME) || (nbPasses == 0))
+    {
+        fprintf(stderr, "-n > %u, -r > 0\n", BENCH_REGIME);
+        return 2;
+    }
+
+    pEch = malloc(nbEch * sizeof(*pEch));
+    if (pEch == NULL)
+    {
+        perror("malloc");
+        return 1;
+    }
+    for (i = 0; i < nbEch; i++)
+    {
+        if (SIM_Alea32(&graine) % 100 == 0)
+        {
+            pEch[i] = (SIM_Alea32(&graine) & 1) ? BENCH_ADC_MAX : 0;
+        }
+        else
+        {
+            pEch[i] = BENCH_CENTRE - BENCH_BRUIT + SIM_Alea32(&graine) % (2 * BENCH_BRUIT + 1);
+        }
+    }
+
+    // Qualité : une passe hors mesure de durée
+    FILTRE_CanalInit(&canal, BENCH_CENTRE);
+    for (i = 0; i < nbEch; i++)
+    {
+        if (FILTRE_CanalAjoute(&canal, pEch[i]))
+        {
+            nbSorties++;
+            if (i >= BENCH_REGIME)
+            {
+                v = FILTRE_CanalValeur(&canal);
+                minS = (v < minS) ? v : minS;
+                maxS = (v > maxS) ? v : maxS;
+            }
+        }
+        if (i >= BENCH_REGIME)
+        {
+            minE = (pEch[i] < minE) ? pEch[i] : minE;
+            maxE = (pEch[i] > maxE) ? pEch[i] : maxE;
+        }
+    }
+
+    // Durée : passe la plus rapide
+    for (p = 0; p < nbPasses; p++)
+    {
+        FILTRE_CanalInit(&canal, BENCH_CENTRE);
+        t0 = TempsNs();
+        c0 = LIT_CYCLES();
+        for (i = 0; i < nbEch; i++)
+        {
+            FILTRE_CanalAjoute(&canal, pEch[i]);
+        }
+        puits = FILTRE_CanalValeur(&canal);
+        cycles = LIT_CYCLES() - c0;
+        ns = TempsNs() - t0;
+        nsMin = (ns < nsMin) ? ns : nsMin;
+        cyclesMin = (cycles < cyclesMin) ? cycles : cyclesMin;
+    }
+    (void)puits;
+
+    if (entete)
+    {
+        printf("mediane,cic_ordre,cic_r,moy,ema_k,ns_ech,cycles_ech,sorties,"
+               "pp_entree,pp_sortie\n");
+    }
+    printf("%u,%u,%u,%u,%u,%.2f,%.2f,%.4f,%u,%u\n",
+           FILTRE_MEDIANE, FILTRE_CIC_ORDRE,
+           FILTRE_CIC_ORDRE ? 1u << FILTRE_CIC_LOG2_R : 1u,
+           FILTRE_MOY_LOG2 ? 1u << FILTRE_MOY_LOG2 : 1u, FILTRE_EMA_K,
+           (double)nsMin / nbEch, (double)cyclesMin / nbEch,
+           (double)nbSorties / nbEch, maxE - minE, maxS - minS);
+    free(pEch);
+    return 0;
+}
@@ -0,0 +1,324 @@
+// sim_fuzz.c
+// Fuzzing de la réception RS232 (interruption USART1 + GetMessage)
+// CFO 17.10.2026 création
+// CFO 17.10.2026 trames v2
+// CFO 17.10.2026 tramage COBS (RS232_COBS) des trames formées
+// CFO 17.10.2026 silence adapté à RX_DRAIN_TO_LATEST = 0
+// CFO 17.10.2026 générateur commun (sim_test.h)
+//
+// Point d'entrée libFuzzer : LLVMFuzzerTestOneInput (compilé avec
+// -DSIM_FUZZ_LIBFUZZER, voir 'make fuzz-libfuzzer'). Sans cette option
+// le programme tp2_fuzz lit ses entrées dans des fichiers ou sur stdin
+// (AFL : afl-fuzz -i cas -o res -- ./tp2_fuzz) :
+//
+// Usage : tp2_fuzz [fichier ...]      une entrée par fichier (stdin sinon)
+//         tp2_fuzz -r nb [-s graine]  nb entrées aléatoires
+//
+// L'entrée est une suite de commandes, chacune introduite par un octet k :
+//   0x00..0x3F : les k octets suivants sont envoyés à la carte sur la
+//                ligne, puis un cycle de 20 ms (ligne + GetMessage)
+// Les trames formées (0x40..0x7F) sont encodées COBS et suivies du
+// délimiteur si RS232_COBS, les octets bruts sont envoyés tels quels.
+//   0x40..0x5F : trame de consigne valide (STX + CRC) formée avec les
+//                2 octets suivants (vitesse, angle), sans cycle
+//   0x60..0x7F : trame v2 avec CRC valide : type et séquence puis
+//                k & 0x1F octets de données (longueur non contrôlée)
+//   0x80..0xBF : (k & 0x3F) + 1 cycles sans nouvel octet
+//   0xC0..0xDF : silence : la ligne est vidée puis CYCLE_MAX + 1 cycles
+//                sans message, la carte doit repasser en local
+//   0xE0..0xFF : entrée CTS de la carte = bit 0 (émission bloquée à 1)
+//
+// Invariants contrôlés après chaque cycle (abort() en cas d'échec) :
+//   - consigne appliquée dans les plages (vitesse ±99, angle ±90) et
+//     absSpeed = |vitesse|
+//   - état interne cohérent (RS232_EtatCoherent : index des fifos dans
+//     leur buffer, décodeur, compteur de cycles)
+//   - pas de blocage du contrôle de flux : la ligne se vide
+//   - retour en local après CYCLE_MAX + 1 cycles sans message
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "sim_hal.h"
+#include "Mc32gest_RS232.h"
+#include "Mc32CalCrc16.h"
+#include "Mc32Cobs.h"
+#include "sim_test.h"
+
+#define FUZZ_TICK_NS 20000000u
+#define FUZZ_BAUD 57600u
+// Taille maximale d'une entrée
+#define FUZZ_TAILLE_MAX 4096
+// Cycles accordés pour vider la ligne avant un silence
+#if RX_DRAIN_TO_LATEST
+#define FUZZ_CYCLES_VIDAGE 100
+#else
+// une consigne (5 octets au moins) appliquée par cycle
+#define FUZZ_CYCLES_VIDAGE (100 + FUZZ_TAILLE_MAX / 5)
+#endif
+// Fifo HW de l'USART1
+#define FUZZ_FIFO_HW 8
+
+static S_pwmSettings fuzzData;
+static int fuzzStatut;
+
+
+static void FuzzEchec(const char *pMessage)
+{
+    fprintf(stderr, "tp2_fuzz: %s (speed %d angle %d abs %u statut %d)\n",
+            pMessage, fuzzData.SpeedSetting, fuzzData.AngleSetting,
+            fuzzData.absSpeed, fuzzStatut);
+    abort();
+}
+
+// Un cycle de l'application, réduit à la réception
+static void FuzzCycle(void)
+{
+    SIM_Avance(FUZZ_TICK_NS);
+    fuzzStatut = GetMessage(&fuzzData);
+
+    if ((fuzzStatut != 0) && (fuzzStatut != 1))
+    {
+        FuzzEchec("statut invalide");
+    }
+    if ((fuzzData.SpeedSetting < -CONSIGNE_VITESSE_MAX) ||
+        (fuzzData.SpeedSetting > CONSIGNE_VITESSE_MAX) ||
+        (fuzzData.AngleSetting < -CONSIGNE_ANGLE_MAX) ||
+        (fuzzData.AngleSetting > CONSIGNE_ANGLE_MAX))
+    {
+        FuzzEchec("consigne hors plage");
+    }
+    if (fuzzData.absSpeed != abs(fuzzData.SpeedSetting))
+    {
+        FuzzEchec("absSpeed incohérent");
+    }
+    if (RS232_EtatCoherent() == 0)
+    {
+        FuzzEchec("état de réception incohérent");
+    }
+}
+
+// Silence sur la ligne : la carte doit repasser en local
+static void FuzzSilence(void)
+{
+    uint32_t c;
+
+    for (c = 0; SIM_UartAEnvoyer() > 0; c++)
+    {
+        if (c >= FUZZ_CYCLES_VIDAGE)
+        {
+            FuzzEchec("ligne bloquée par le contrôle de flux");
+        }
+        FuzzCycle();
+    }
+    // dernier cycle : octets encore dans les fifos décodés (un message
+    // par cycle si RX_DRAIN_TO_LATEST = 0)
+#if RX_DRAIN_TO_LATEST
+    FuzzCycle();
+#else
+    for (c = 0; c <= (descrFifoRX.size + FUZZ_FIFO_HW) / 5; c++)
+    {
+        FuzzCycle();
+    }
+#endif
+    for (c = 0; c < CYCLE_MAX + 1; c++)
+    {
+        FuzzCycle();
+    }
+    if (fuzzStatut != 0)
+    {
+        FuzzEchec("pas de retour en local");
+    }
+}
+
+// Trame formée envoyée sur la ligne, avec le tramage de la carte
+static void FuzzEnvoie(const uint8_t *pTrame, uint32_t taille)
+{
+#if RS232_COBS
+    int8_t ligne[COBS_TAILLE_ENCODEE(V2_TAILLE_ENTETE + 0x1F + 2) + 1];
+    uint32_t nb = COBS_Encode((const int8_t *)pTrame, taille, ligne);
+
+    ligne[nb++] = COBS_DELIMITEUR;
+    SIM_UartEnvoie((const uint8_t *)ligne, nb);
+#else
+    SIM_UartEnvoie(pTrame, taille);
+#endif
+}
+
+static void FuzzTrame(uint8_t speed, uint8_t angle)
+{
+    uint8_t trame[5];
+    uint16_t crc;
+
+    trame[0] = 0xAA;
+    trame[1] = speed;
+    trame[2] = angle;
+    crc = crc16_ccitt(trame, 3, 0xFFFF);
+    trame[3] = crc >> 8;
+    trame[4] = crc & 0xFF;
+    FuzzEnvoie(trame, 5);
+}
+
+static void FuzzTrameV2(const uint8_t *pData, uint8_t longueur)
+{
+    uint8_t trame[V2_TAILLE_ENTETE + 0x1F + 2];
+    uint16_t crc;
+
+    trame[0] = 0xAB;
+    trame[1] = V2_VERSION;
+    trame[2] = pData[0];
+    trame[3] = pData[1];
+    trame[4] = longueur;
+    memcpy(&trame[V2_TAILLE_ENTETE], &pData[2], longueur);
+    crc = crc16_ccitt(trame, V2_TAILLE_ENTETE + longueur, 0xFFFF);
+    trame[V2_TAILLE_ENTETE + longueur] = crc >> 8;
+    trame[V2_TAILLE_ENTETE + longueur + 1] = crc & 0xFF;
+    FuzzEnvoie(trame, V2_TAILLE_ENTETE + longueur + 2);
+}
+
+static void FuzzEntree(const uint8_t *pData, size_t taille)
+{
+    size_t i = 0;
+    uint8_t k, nb;
+
+    SIM_Init(FUZZ_BAUD);
+    InitFifoComm();
+    memset(&fuzzData, 0, sizeof(fuzzData));
+    fuzzStatut = 0;
+    if (taille > FUZZ_TAILLE_MAX)
+    {
+        taille = FUZZ_TAILLE_MAX;
+    }
+
+    while (i < taille)
+    {
+        k = pData[i++];
+        if (k < 0x40)
+        {
+            nb = (k <= taille - i) ? k : (uint8_t)(taille - i);
+            SIM_UartEnvoie(&pData[i], nb);
+            i += nb;
+            FuzzCycle();
+        }
+        else if (k < 0x60)
+        {
+            if (taille - i < 2)
+            {
+                break;
+            }
+            FuzzTrame(pData[i], pData[i + 1]);
+            i += 2;
+        }
+        else if (k < 0x80)
+        {
+            nb = k & 0x1F;
+            if (taille - i < 2u + nb)
+            {
+                break;
+            }
+            FuzzTrameV2(&pData[i], nb);
+            i += 2 + nb;
+        }
+        else if (k < 0xC0)
+        {
+            for (nb = 0; nb <= (k & 0x3F); nb++)
+            {
+                FuzzCycle();
+            }
+        }
+        else if (k < 0xE0)
+        {
+            FuzzSilence();
+        }
+        else
+        {
+            SimCts = k & 1;
+        }
+    }
+    // fin de l'entrée : toujours un silence complet
+    SimCts = 0;
+    FuzzSilence();
+}
+
+
+#ifdef SIM_FUZZ_LIBFUZZER
+
+int LLVMFuzzerTestOneInput(const uint8_t *pData, size_t taille)
+{
+    FuzzEntree(pData, taille);
+    return 0;
+}
+
+#else
+
+static uint64_t graine = 1;
+
+static void FuzzFichier(FILE *pFichier)
+{
+    static uint8_t tampon[FUZZ_TAILLE_MAX];
+    size_t nb = fread(tampon, 1, sizeof(tampon), pFichier);
+
+    FuzzEntree(tampon, nb);
+}
+
+int main(int argc, char *argv[])
+{
+    static uint8_t tampon[512];
+    uint32_t nbAleatoires = 0;
+    uint32_t n, i, taille;
+    FILE *pFichier;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'r':
+                nbAleatoires = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                graine = SIM_AleaGraine(strtoull(optarg, NULL, 0));
+                break;
+            default:
+                fprintf(stderr, "usage: %s [fichier ...] | -r nb [-s graine]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (nbAleatoires > 0)
+    {
+        for (n = 0; n < nbAleatoires; n++)
+        {
+            taille = SIM_Alea32(&graine) % sizeof(tampon);
+            for (i = 0; i < taille; i++)
+            {
+                tampon[i] = (uint8_t)SIM_Alea32(&graine);
+            }
+            FuzzEntree(tampon, taille);
+        }
+        printf("%u entrées, crc_err: %u hors_plage: %u format: %u perdues: %u "
+               "dupliquees: %u\n", nbAleatoires, NbrErreursCrc, NbrMessHorsPlage,
+               NbrErreursFormat, NbrTramesPerdues, NbrTramesDupliquees);
+        return 0;
+    }
+    if (optind >= argc)
+    {
+        FuzzFichier(stdin);
+        return 0;
+    }
+    for (; optind < argc; optind++)
+    {
+        pFichier = fopen(argv[optind], "rb");
+        if (pFichier == NULL)
+        {
+            perror(argv[optind]);
+            return 1;
+        }
+        FuzzFichier(pFichier);
+        fclose(pFichier);
+    }
+    return 0;
+}
+
+#endif
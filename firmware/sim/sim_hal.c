@@ -0,0 +1,634 @@
+// sim_hal.c
+// HAL simulé pour la compilation hors cible de l'application TP2
+// CFO 17.10.2026 création (USART1, interruptions, ADC, OC, LCD)
+// CFO 17.10.2026 changement de débit (DRV_USART0_BaudSet)
+// CFO 17.10.2026 acquisition ADC continue par DMA (ADC_DMA)
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "sim_hal.h"
+#include "Mc32gest_RS232.h"
+#include "Mc32DmaUart.h"
+#include "Mc32AdcDma.h"
+#include "Mc32Profil.h"
+#include "app.h"
+
+
+// Etat visible de la carte
+uint8_t SimLed[8];
+uint8_t SimRts = 1;
+uint8_t SimCts = 0;
+char SimLcd[SIM_LCD_LIGNES][SIM_LCD_COLONNES + 1];
+uint16_t SimOcLargeur[SIM_NB_OC];
+uint8_t SimAin1, SimAin2;
+uint32_t SimUartNbrOverrun = 0;
+uint32_t SimNbrIntUart = 0;
+uint32_t SimDebit = 0;
+
+// Contrôleur d'interruptions
+static bool intFlag[SIM_NB_INT_SOURCES];
+static bool intEnable[SIM_NB_INT_SOURCES];
+static bool dansIsr = false;
+
+// Fifo HW de réception et d'émission de l'USART1
+typedef struct
+{
+    uint8_t data[SIM_UART_FIFO_HW];
+    uint8_t lecture;
+    uint8_t nb;
+} S_simFifoHw;
+
+static S_simFifoHw uartRx, uartTx;
+static bool uartOerr = false;
+static bool uartRxIdle = true;
+static uint8_t uartSeuilRx = 1;
+
+// Ligne série : octets envoyés par le partenaire, pas encore émis
+#define SIM_LIGNE_TAILLE 4096
+static uint8_t ligneRx[SIM_LIGNE_TAILLE];
+static uint32_t ligneRxLecture = 0;
+static uint32_t ligneRxNb = 0;
+
+#if RS232_TX_DMA
+// Morceau confié au DMA d'émission, en cours sur la ligne
+static int8_t ligneTxDma[DMA_UART_BLOC_MAX];
+static uint32_t ligneTxDmaLecture = 0;
+static uint32_t ligneTxDmaNb = 0;
+#endif
+
+static SIM_SortieTx pSortieTx = NULL;
+static void *pSortieContexte = NULL;
+
+// Temps simulé
+static uint32_t dureeOctetNs;
+static uint32_t resteNs = 0;
+static uint64_t tempsNs = 0;
+
+// ADC, LCD
+static S_ADCResultsAlt adc = { 512, 512 };
+#if ADC_DMA
+static uint64_t adcProchaineNs = 0;     // prochaine fin de conversion
+#endif
+static uint8_t lcdX = 1, lcdY = 1;
+
+
+/*--------------------------------------------------------*/
+// Contrôleur d'interruptions
+/*--------------------------------------------------------*/
+
+bool PLIB_INT_SourceFlagGet(INT_MODULE_ID id, INT_SOURCE source)
+{
+    (void)id;
+    return intFlag[source];
+}
+
+void PLIB_INT_SourceFlagSet(INT_MODULE_ID id, INT_SOURCE source)
+{
+    (void)id;
+    intFlag[source] = true;
+    SIM_IntDispatch();
+}
+
+void PLIB_INT_SourceFlagClear(INT_MODULE_ID id, INT_SOURCE source)
+{
+    (void)id;
+    intFlag[source] = false;
+}
+
+bool PLIB_INT_SourceIsEnabled(INT_MODULE_ID id, INT_SOURCE source)
+{
+    (void)id;
+    return intEnable[source];
+}
+
+void PLIB_INT_SourceEnable(INT_MODULE_ID id, INT_SOURCE source)
+{
+    (void)id;
+    intEnable[source] = true;
+    SIM_IntDispatch();
+}
+
+void PLIB_INT_SourceDisable(INT_MODULE_ID id, INT_SOURCE source)
+{
+    (void)id;
+    intEnable[source] = false;
+}
+
+void PLIB_INT_VectorPrioritySet(INT_MODULE_ID id, INT_VECTOR vecteur, INT_PRIORITY_LEVEL prio)
+{
+    (void)id;
+    (void)vecteur;
+    (void)prio;
+}
+
+void PLIB_INT_VectorSubPrioritySet(INT_MODULE_ID id, INT_VECTOR vecteur, INT_SUBPRIORITY_LEVEL sousPrio)
+{
+    (void)id;
+    (void)vecteur;
+    (void)sousPrio;
+}
+
+
+// Flags à niveau de l'USART1 (seuil RX, fifo TX vide)
+static void MajFlagsUart(void)
+{
+    if (uartRx.nb >= uartSeuilRx)
+    {
+        intFlag[INT_SOURCE_USART_1_RECEIVE] = true;
+    }
+    if (uartTx.nb == 0)
+    {
+        intFlag[INT_SOURCE_USART_1_TRANSMIT] = true;
+    }
+}
+
+static bool UartIntEnAttente(void)
+{
+    return (intFlag[INT_SOURCE_USART_1_ERROR] && intEnable[INT_SOURCE_USART_1_ERROR]) ||
+           (intFlag[INT_SOURCE_USART_1_RECEIVE] && intEnable[INT_SOURCE_USART_1_RECEIVE]) ||
+           (intFlag[INT_SOURCE_USART_1_TRANSMIT] && intEnable[INT_SOURCE_USART_1_TRANSMIT]);
+}
+
+// Pas de préemption : les routines sont appelées entre deux appels
+// de l'application, jamais depuis une autre routine d'interruption
+void SIM_IntDispatch(void)
+{
+    uint8_t n;
+
+    if (dansIsr)
+    {
+        return;
+    }
+    dansIsr = true;
+    for (n = 0; n < 16; n++)
+    {
+        MajFlagsUart();
+        if (!UartIntEnAttente())
+        {
+            break;
+        }
+        SimNbrIntUart++;
+        _IntHandlerDrvUsartInstance0();
+    }
+#if ADC_DMA
+    // priorité inférieure à l'USART1
+    if (intFlag[INT_SOURCE_DMA_3] && intEnable[INT_SOURCE_DMA_3])
+    {
+        _IntHandlerDmaAdc();
+    }
+#endif
+    dansIsr = false;
+}
+
+
+/*--------------------------------------------------------*/
+// USART1
+/*--------------------------------------------------------*/
+
+bool PLIB_USART_ReceiverDataIsAvailable(USART_MODULE_ID id)
+{
+    (void)id;
+    return uartRx.nb > 0;
+}
+
+uint8_t PLIB_USART_ReceiverByteReceive(USART_MODULE_ID id)
+{
+    uint8_t octet;
+
+    (void)id;
+    if (uartRx.nb == 0)
+    {
+        return 0;
+    }
+    octet = uartRx.data[uartRx.lecture];
+    uartRx.lecture = (uartRx.lecture + 1) % SIM_UART_FIFO_HW;
+    uartRx.nb--;
+    return octet;
+}
+
+bool PLIB_USART_ReceiverIsIdle(USART_MODULE_ID id)
+{
+    (void)id;
+    return uartRxIdle;
+}
+
+USART_ERROR PLIB_USART_ErrorsGet(USART_MODULE_ID id)
+{
+    (void)id;
+    return uartOerr ? USART_ERROR_RECEIVER_OVERRUN : USART_ERROR_NONE;
+}
+
+// Comme sur le PIC32 : l'effacement de OERR vide le fifo HW
+void PLIB_USART_ReceiverOverrunErrorClear(USART_MODULE_ID id)
+{
+    (void)id;
+    uartOerr = false;
+    uartRx.nb = 0;
+}
+
+void PLIB_USART_ReceiverInterruptModeSelect(USART_MODULE_ID id, USART_RECEIVE_INTR_MODE mode)
+{
+    (void)id;
+    switch (mode)
+    {
+        case USART_RECEIVE_FIFO_HALF_FULL:
+            uartSeuilRx = 4;
+            break;
+        case USART_RECEIVE_FIFO_3B4FULL:
+            uartSeuilRx = 6;
+            break;
+        default:
+            uartSeuilRx = 1;
+            break;
+    }
+}
+
+bool PLIB_USART_TransmitterBufferIsFull(USART_MODULE_ID id)
+{
+    (void)id;
+    return uartTx.nb >= SIM_UART_FIFO_HW;
+}
+
+bool PLIB_USART_TransmitterIsEmpty(USART_MODULE_ID id)
+{
+    (void)id;
+#if RS232_TX_DMA
+    return (uartTx.nb == 0) && (ligneTxDmaNb == 0);
+#else
+    return uartTx.nb == 0;
+#endif
+}
+
+// Le partenaire simulé suit le débit de la carte
+DRV_USART_BAUD_SET_RESULT DRV_USART0_BaudSet(uint32_t baud)
+{
+    if (baud == 0)
+    {
+        return DRV_USART_BAUD_SET_ERROR;
+    }
+    SimDebit = baud;
+    // 1 start + 8 data + 1 stop
+    dureeOctetNs = (uint32_t)(10000000000ull / baud);
+    return DRV_USART_BAUD_SET_SUCCESS;
+}
+
+void PLIB_USART_TransmitterByteSend(USART_MODULE_ID id, uint8_t data)
+{
+    (void)id;
+    if (uartTx.nb < SIM_UART_FIFO_HW)
+    {
+        uartTx.data[(uartTx.lecture + uartTx.nb) % SIM_UART_FIFO_HW] = data;
+        uartTx.nb++;
+    }
+}
+
+
+/*--------------------------------------------------------*/
+// Timers, OC, ports
+/*--------------------------------------------------------*/
+
+uint16_t PLIB_TMR_Counter16BitGet(TMR_MODULE_ID id)
+{
+    (void)id;
+    return 0;
+}
+
+void PLIB_OC_PulseWidth16BitSet(OC_MODULE_ID id, uint16_t largeur)
+{
+    SimOcLargeur[id] = largeur;
+}
+
+void PLIB_PORTS_PinSet(PORTS_MODULE_ID id, PORTS_CHANNEL port, uint8_t bit)
+{
+    (void)id;
+    (void)port;
+    if (bit == AIN1_HBRIDGE_BIT)
+    {
+        SimAin1 = 1;
+    }
+    else if (bit == AIN2_HBRIDGE_BIT)
+    {
+        SimAin2 = 1;
+    }
+}
+
+void PLIB_PORTS_PinClear(PORTS_MODULE_ID id, PORTS_CHANNEL port, uint8_t bit)
+{
+    (void)id;
+    (void)port;
+    if (bit == AIN1_HBRIDGE_BIT)
+    {
+        SimAin1 = 0;
+    }
+    else if (bit == AIN2_HBRIDGE_BIT)
+    {
+        SimAin2 = 0;
+    }
+}
+
+bool DRV_TMR0_Start(void)
+{
+    return true;
+}
+
+bool DRV_TMR1_Start(void)
+{
+    return true;
+}
+
+bool DRV_TMR2_Start(void)
+{
+    return true;
+}
+
+// Période du timer 2 (PWM du moteur, 40 kHz)
+uint32_t DRV_TMR1_PeriodValueGet(void)
+{
+    return 1999;
+}
+
+void DRV_OC0_Start(void)
+{
+}
+
+void DRV_OC1_Start(void)
+{
+}
+
+
+/*--------------------------------------------------------*/
+// BSP
+/*--------------------------------------------------------*/
+
+void BSP_LEDOn(BSP_LED led)
+{
+    SimLed[led] = 1;
+}
+
+void BSP_LEDOff(BSP_LED led)
+{
+    SimLed[led] = 0;
+}
+
+void BSP_LEDToggle(BSP_LED led)
+{
+    SimLed[led] = !SimLed[led];
+}
+
+void BSP_EnableHbrige(void)
+{
+}
+
+void BSP_InitADC10Alt(void)
+{
+}
+
+S_ADCResultsAlt BSP_ReadADCAlt(void)
+{
+    return adc;
+}
+
+void lcd_init(void)
+{
+    uint8_t y;
+
+    for (y = 0; y < SIM_LCD_LIGNES; y++)
+    {
+        lcd_ClearLine(y + 1);
+    }
+    lcdX = 1;
+    lcdY = 1;
+}
+
+void lcd_bl_on(void)
+{
+}
+
+void lcd_gotoxy(uint8_t x, uint8_t y)
+{
+    lcdX = x;
+    lcdY = y;
+}
+
+void lcd_ClearLine(uint8_t ligne)
+{
+    if ((ligne >= 1) && (ligne <= SIM_LCD_LIGNES))
+    {
+        memset(SimLcd[ligne - 1], ' ', SIM_LCD_COLONNES);
+        SimLcd[ligne - 1][SIM_LCD_COLONNES] = '\0';
+    }
+}
+
+// Texte écrit à partir du curseur, coupé en fin de ligne
+void printf_lcd(const char *format, ...)
+{
+    char texte[64];
+    va_list args;
+    uint8_t i;
+
+    va_start(args, format);
+    vsnprintf(texte, sizeof(texte), format, args);
+    va_end(args);
+
+    if ((lcdY < 1) || (lcdY > SIM_LCD_LIGNES))
+    {
+        return;
+    }
+    for (i = 0; (texte[i] != '\0') && (lcdX >= 1) && (lcdX <= SIM_LCD_COLONNES); i++)
+    {
+        SimLcd[lcdY - 1][lcdX - 1] = texte[i];
+        lcdX++;
+    }
+}
+
+
+/*--------------------------------------------------------*/
+// Pilotage du simulateur
+/*--------------------------------------------------------*/
+
+void SIM_Init(uint32_t baud)
+{
+    memset(intFlag, 0, sizeof(intFlag));
+    memset(intEnable, 0, sizeof(intEnable));
+    memset(&uartRx, 0, sizeof(uartRx));
+    memset(&uartTx, 0, sizeof(uartTx));
+    memset(SimLed, 0, sizeof(SimLed));
+    memset(SimOcLargeur, 0, sizeof(SimOcLargeur));
+    uartOerr = false;
+    uartRxIdle = true;
+    uartSeuilRx = 1;
+    ligneRxLecture = 0;
+    ligneRxNb = 0;
+#if RS232_TX_DMA
+    ligneTxDmaNb = 0;
+#endif
+    SimRts = 1;
+    SimCts = 0;
+    SimUartNbrOverrun = 0;
+    SimNbrIntUart = 0;
+    resteNs = 0;
+    tempsNs = 0;
+#if ADC_DMA
+    adcProchaineNs = ADC_DMA_PERIODE_NS;
+#endif
+    DRV_USART0_BaudSet(baud);
+    lcd_init();
+
+    // comme DRV_USART0_Initialize : interruptions erreur et RX
+    intEnable[INT_SOURCE_USART_1_ERROR] = true;
+    intEnable[INT_SOURCE_USART_1_RECEIVE] = true;
+}
+
+void SIM_SortieTxSet(SIM_SortieTx pSortie, void *pContexte)
+{
+    pSortieTx = pSortie;
+    pSortieContexte = pContexte;
+}
+
+void SIM_UartEnvoie(const uint8_t *pData, uint32_t nbChar)
+{
+    while ((nbChar > 0) && (ligneRxNb < SIM_LIGNE_TAILLE))
+    {
+        ligneRx[(ligneRxLecture + ligneRxNb) % SIM_LIGNE_TAILLE] = *pData;
+        ligneRxNb++;
+        pData++;
+        nbChar--;
+    }
+}
+
+uint32_t SIM_UartAEnvoyer(void)
+{
+    return ligneRxNb;
+}
+
+void SIM_AdcSet(uint16_t chan0, uint16_t chan1)
+{
+    adc.Chan0 = chan0;
+    adc.Chan1 = chan1;
+}
+
+uint64_t SIM_TempsNs(void)
+{
+    return tempsNs + resteNs;
+}
+
+
+void SIM_Tick(void)
+{
+    ISRP_ENTREE(ISRP_TMR1);
+    callback_timer1();
+    ISRP_SORTIE(ISRP_TMR1);
+}
+
+
+// Un octet reçu par la carte (fin du bit de stop)
+static void OctetRecu(uint8_t octet)
+{
+#if RS232_RX_DMA
+    if (descrFifoRX.size == 0)
+    {
+        // DMA pas encore configuré
+        SimUartNbrOverrun++;
+        return;
+    }
+    DMAUART_SimRxBytes((const int8_t *)&octet, 1);
+#else
+    if (uartOerr)
+    {
+        SimUartNbrOverrun++;
+    }
+    else if (uartRx.nb >= SIM_UART_FIFO_HW)
+    {
+        uartOerr = true;
+        intFlag[INT_SOURCE_USART_1_ERROR] = true;
+        SimUartNbrOverrun++;
+    }
+    else
+    {
+        uartRx.data[(uartRx.lecture + uartRx.nb) % SIM_UART_FIFO_HW] = octet;
+        uartRx.nb++;
+    }
+#endif
+}
+
+// Un octet émis par la carte
+static void OctetEmis(void)
+{
+    uint8_t octet;
+
+#if RS232_TX_DMA
+    if ((ligneTxDmaNb == 0) && (descrFifoTX.size != 0))
+    {
+        // le canal DMA vide un morceau du fifo d'émission
+        ligneTxDmaNb = DMAUART_SimTxTransfert(&descrFifoTX, ligneTxDma, SimCts == 0);
+        ligneTxDmaLecture = 0;
+    }
+    if (ligneTxDmaNb == 0)
+    {
+        return;
+    }
+    octet = ligneTxDma[ligneTxDmaLecture++];
+    ligneTxDmaNb--;
+#else
+    if (uartTx.nb == 0)
+    {
+        return;
+    }
+    octet = uartTx.data[uartTx.lecture];
+    uartTx.lecture = (uartTx.lecture + 1) % SIM_UART_FIFO_HW;
+    uartTx.nb--;
+#endif
+    if (pSortieTx != NULL)
+    {
+        pSortieTx(octet, pSortieContexte);
+    }
+}
+
+#if ADC_DMA
+// Conversions ADC terminées jusqu'au temps courant : balayage des 2
+// canaux, copie par le DMA simulé, interruption par bloc complet
+static void AdcConversions(void)
+{
+    uint16_t valeur;
+
+    while (tempsNs >= adcProchaineNs)
+    {
+        adcProchaineNs += ADC_DMA_PERIODE_NS;
+        valeur = (ADCDMA_SimCanal() == 0) ? adc.Chan0 : adc.Chan1;
+        if (ADCDMA_SimConversion(valeur))
+        {
+            intFlag[INT_SOURCE_DMA_3] = true;
+        }
+    }
+}
+#endif
+
+// La ligne avance d'un temps d'octet à la fois, en full duplex
+void SIM_Avance(uint32_t dureeNs)
+{
+    uint64_t total = (uint64_t)resteNs + dureeNs;
+
+    while (total >= dureeOctetNs)
+    {
+        total -= dureeOctetNs;
+        tempsNs += dureeOctetNs;
+
+        // le partenaire respecte le RTS de la carte
+        uartRxIdle = true;
+        if ((ligneRxNb > 0) && (SimRts == 0))
+        {
+            OctetRecu(ligneRx[ligneRxLecture]);
+            ligneRxLecture = (ligneRxLecture + 1) % SIM_LIGNE_TAILLE;
+            ligneRxNb--;
+            uartRxIdle = false;
+        }
+        OctetEmis();
+#if ADC_DMA
+        AdcConversions();
+#endif
+        SIM_IntDispatch();
+    }
+    // le reste est reporté à l'appel suivant
+    resteNs = (uint32_t)total;
+}
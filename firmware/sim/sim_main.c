@@ -0,0 +1,230 @@
+// sim_main.c
+// Exécution de l'application TP2 sur le HAL simulé (PC Linux)
+// CFO 17.10.2026 création
+// CFO 17.10.2026 liaison PTY et exécution en temps réel
+//
+// Usage : tp2_sim [-n cycles] [-b bauds] [-a adc0,adc1] [-i fichier_rx]
+//                 [-o fichier_tx] [-P | -d periph] [-r]
+//   -n : nombre de cycles de 20 ms simulés après l'initialisation (3 s),
+//        0 = sans fin
+//   -b : débit de la ligne série (57600 par défaut)
+//   -a : valeurs des potentiomètres (0..1023)
+//   -i : octets envoyés à la carte dès la fin de l'initialisation
+//   -o : octets émis par la carte
+//   -P : USART1 relié à un nouveau PTY (nom affiché au démarrage)
+//   -d : USART1 relié à un terminal existant (port série, null-modem)
+//   -r : temps réel (implicite avec -P / -d)
+// L'état final (LCD, PWM, compteurs) est affiché sur stdout.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include "sim_hal.h"
+#include "sim_pty.h"
+#include "app.h"
+#include "Mc32gest_RS232.h"
+#include "Mc32AdcDma.h"
+
+// Période du timer 1 : 20 ms, découpée en pas de 1 ms
+#define SIM_TICK_NS 20000000u
+#define SIM_PAS_NS 1000000u
+// Durée de l'initialisation (APP_STATE_INIT pendant 3 s)
+#define SIM_CYCLES_INIT (COMPTEUR_3_SECONDES + 1)
+
+extern S_pwmSettings PWMData;
+
+
+static uint8_t avecPty = 0;
+static uint8_t tempsReel = 0;
+static struct timespec echeance;
+static volatile sig_atomic_t arret = 0;
+
+static void SimArret(int signal)
+{
+    (void)signal;
+    arret = 1;
+}
+
+// Attente de la fin du pas courant en temps réel
+static void SimAttentePas(void)
+{
+    echeance.tv_nsec += SIM_PAS_NS;
+    if (echeance.tv_nsec >= 1000000000)
+    {
+        echeance.tv_nsec -= 1000000000;
+        echeance.tv_sec++;
+    }
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &echeance, NULL);
+}
+
+// Un cycle de 20 ms : tick, tâche de l'application, ligne série
+static void SimCycle(void)
+{
+    uint32_t pas;
+
+    SIM_Tick();
+    APP_Tasks();
+    if ((avecPty == 0) && (tempsReel == 0))
+    {
+        SIM_Avance(SIM_TICK_NS);
+        return;
+    }
+    for (pas = 0; pas < SIM_TICK_NS / SIM_PAS_NS; pas++)
+    {
+        if (avecPty)
+        {
+            SIM_PtyService();
+        }
+        SIM_Avance(SIM_PAS_NS);
+        if (tempsReel)
+        {
+            SimAttentePas();
+        }
+    }
+}
+
+static void SortieFichier(uint8_t octet, void *pContexte)
+{
+    fputc(octet, (FILE *)pContexte);
+}
+
+static void Affiche(void)
+{
+    uint8_t y;
+
+    for (y = 0; y < SIM_LCD_LIGNES; y++)
+    {
+        printf("lcd%u: |%s|\n", y + 1, SimLcd[y]);
+    }
+    printf("speed: %d angle: %d\n", PWMData.SpeedSetting, PWMData.AngleSetting);
+    printf("oc2: %u oc3: %u ain1: %u ain2: %u\n",
+           SimOcLargeur[OC_ID_2], SimOcLargeur[OC_ID_3], SimAin1, SimAin2);
+    printf("crc_err: %u remplaces: %u overrun: %u int_uart: %u\n",
+           NbrErreursCrc, NbrMessRemplaces, SimUartNbrOverrun, SimNbrIntUart);
+    printf("debit: %u echecs_debit: %u\n", SimDebit, NbrDebitsEchoues);
+#if ADC_DMA
+    printf("blocs_adc_perdus: %u\n", ADCDMA_NbrBlocsPerdus);
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t nbCycles = 250;
+    uint32_t baud = 57600;
+    unsigned adc0 = 512, adc1 = 512;
+    const char *nomRx = NULL;
+    const char *nomTx = NULL;
+    const char *nomPeriph = NULL;
+    FILE *pTx = NULL;
+    uint32_t c;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:b:a:i:o:Pd:r")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                nbCycles = strtoul(optarg, NULL, 0);
+                break;
+            case 'b':
+                baud = strtoul(optarg, NULL, 0);
+                break;
+            case 'a':
+                if (sscanf(optarg, "%u,%u", &adc0, &adc1) != 2)
+                {
+                    fprintf(stderr, "-a adc0,adc1\n");
+                    return 2;
+                }
+                break;
+            case 'i':
+                nomRx = optarg;
+                break;
+            case 'o':
+                nomTx = optarg;
+                break;
+            case 'P':
+                avecPty = 1;
+                break;
+            case 'd':
+                avecPty = 1;
+                nomPeriph = optarg;
+                break;
+            case 'r':
+                tempsReel = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n cycles] [-b bauds] [-a adc0,adc1] "
+                        "[-i fichier_rx] [-o fichier_tx] [-P | -d periph] [-r]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    SIM_Init(baud);
+    SIM_AdcSet(adc0, adc1);
+    if (nomTx != NULL)
+    {
+        pTx = fopen(nomTx, "wb");
+        if (pTx == NULL)
+        {
+            perror(nomTx);
+            return 1;
+        }
+        SIM_SortieTxSet(SortieFichier, pTx);
+    }
+
+    if (avecPty)
+    {
+        if (pTx != NULL)
+        {
+            fprintf(stderr, "-o incompatible avec -P / -d\n");
+            return 1;
+        }
+        if (SIM_PtyOuvre(nomPeriph) != 0)
+        {
+            return 1;
+        }
+        printf("uart1: %s\n", SIM_PtyNom());
+        fflush(stdout);
+        tempsReel = 1;
+    }
+    signal(SIGINT, SimArret);
+    signal(SIGTERM, SimArret);
+    clock_gettime(CLOCK_MONOTONIC, &echeance);
+
+    APP_Initialize();
+    for (c = 0; c < SIM_CYCLES_INIT; c++)
+    {
+        SimCycle();
+    }
+
+    if (nomRx != NULL)
+    {
+        uint8_t tampon[4096];
+        size_t nb;
+        FILE *pRx = fopen(nomRx, "rb");
+
+        if (pRx == NULL)
+        {
+            perror(nomRx);
+            return 1;
+        }
+        nb = fread(tampon, 1, sizeof(tampon), pRx);
+        fclose(pRx);
+        SIM_UartEnvoie(tampon, (uint32_t)nb);
+    }
+
+    for (c = 0; ((nbCycles == 0) || (c < nbCycles)) && (arret == 0); c++)
+    {
+        SimCycle();
+    }
+
+    if (pTx != NULL)
+    {
+        fclose(pTx);
+    }
+    SIM_PtyFerme();
+    Affiche();
+    return 0;
+}
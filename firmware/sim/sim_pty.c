@@ -0,0 +1,170 @@
+// sim_pty.c
+// Liaison entre l'USART1 simulé et un terminal Linux
+// CFO 17.10.2026 création
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+#include "sim_hal.h"
+#include "sim_pty.h"
+
+// Octets en attente sur la ligne RX simulée au-delà desquels le
+// terminal n'est plus lu (le débit reste celui de la ligne simulée)
+#define PTY_LIGNE_MAX 16
+// Octets émis par la carte et refusés par le terminal
+#define PTY_ATTENTE_TAILLE 512
+
+static int fdPty = -1;
+static char nomPty[128];
+static uint8_t lignesModem = 0;
+static uint8_t attente[PTY_ATTENTE_TAILLE];
+static uint32_t attenteNb = 0;
+
+
+// Octet émis par la carte : mis en attente, écrit par SIM_PtyService
+static void PtySortie(uint8_t octet, void *pContexte)
+{
+    (void)pContexte;
+    if (attenteNb < PTY_ATTENTE_TAILLE)
+    {
+        attente[attenteNb++] = octet;
+    }
+}
+
+
+// Terminal en mode brut, non bloquant
+static void PtyModeBrut(int fd)
+{
+    struct termios tio;
+
+    if (tcgetattr(fd, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+
+int SIM_PtyOuvre(const char *nomPeriph)
+{
+    int etatModem;
+
+    if (nomPeriph == NULL)
+    {
+        fdPty = posix_openpt(O_RDWR | O_NOCTTY);
+        if ((fdPty < 0) || (grantpt(fdPty) != 0) || (unlockpt(fdPty) != 0))
+        {
+            perror("posix_openpt");
+            return -1;
+        }
+        snprintf(nomPty, sizeof(nomPty), "%s", ptsname(fdPty));
+    }
+    else
+    {
+        fdPty = open(nomPeriph, O_RDWR | O_NOCTTY);
+        if (fdPty < 0)
+        {
+            perror(nomPeriph);
+            return -1;
+        }
+        snprintf(nomPty, sizeof(nomPty), "%s", nomPeriph);
+    }
+    PtyModeBrut(fdPty);
+
+    // lignes modem disponibles ? (pas sur un PTY Linux)
+    lignesModem = (ioctl(fdPty, TIOCMGET, &etatModem) == 0);
+    attenteNb = 0;
+    SIM_SortieTxSet(PtySortie, NULL);
+    return 0;
+}
+
+
+const char *SIM_PtyNom(void)
+{
+    return nomPty;
+}
+
+
+void SIM_PtyService(void)
+{
+    uint8_t tampon[PTY_LIGNE_MAX];
+    uint32_t place;
+    ssize_t nb;
+    int etatModem;
+
+    if (fdPty < 0)
+    {
+        return;
+    }
+
+    // carte -> terminal
+    if (attenteNb > 0)
+    {
+        nb = write(fdPty, attente, attenteNb);
+        if (nb > 0)
+        {
+            memmove(attente, &attente[nb], attenteNb - nb);
+            attenteNb -= nb;
+        }
+    }
+
+    // terminal -> carte, seulement si la carte autorise (RTS = 0)
+    if (lignesModem)
+    {
+        if (ioctl(fdPty, TIOCMGET, &etatModem) == 0)
+        {
+            // RTS carte à 0 = le partenaire peut émettre (RTS actif)
+            if (SimRts == 0)
+            {
+                etatModem |= TIOCM_RTS;
+            }
+            else
+            {
+                etatModem &= ~TIOCM_RTS;
+            }
+            ioctl(fdPty, TIOCMSET, &etatModem);
+            // CTS actif = émission autorisée (entrée carte à 0)
+            SimCts = (etatModem & TIOCM_CTS) ? 0 : 1;
+        }
+    }
+    else
+    {
+        // pas de lignes modem : le terminal plein arrête la carte
+        SimCts = (attenteNb > 0) ? 1 : 0;
+    }
+
+    if (SimRts == 0)
+    {
+        place = PTY_LIGNE_MAX - SIM_UartAEnvoyer();
+        if (place > PTY_LIGNE_MAX)
+        {
+            place = 0;
+        }
+        if (place > 0)
+        {
+            nb = read(fdPty, tampon, place);
+            if (nb > 0)
+            {
+                SIM_UartEnvoie(tampon, (uint32_t)nb);
+            }
+        }
+    }
+}
+
+
+void SIM_PtyFerme(void)
+{
+    if (fdPty >= 0)
+    {
+        close(fdPty);
+        fdPty = -1;
+    }
+    SIM_SortieTxSet(NULL, NULL);
+}
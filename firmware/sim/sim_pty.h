@@ -0,0 +1,43 @@
+#ifndef SIM_PTY_H
+#define SIM_PTY_H
+/*--------------------------------------------------------*/
+// sim_pty.h
+/*--------------------------------------------------------*/
+//	Description :	liaison entre l'USART1 simulé et un terminal
+//			        Linux (PTY ou port série existant)
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.0
+//	Compilateur	:	gcc / clang (C99)
+//
+//  Les octets lus sur le terminal sont envoyés à la carte au débit
+//  de la ligne simulée, les octets émis par la carte sont écrits
+//  sur le terminal.
+//
+//  Contrôle de flux :
+//   - si le terminal gère les lignes modem (TIOCMGET / TIOCMSET :
+//     port série réel, paire null-modem tty0tty...), le RTS de la
+//     carte est recopié sur RTS et CTS est lu sur CTS ;
+//   - sinon (PTY Linux, sans lignes modem) : RTS = 1 suspend la
+//     lecture du terminal (le noyau bloque alors l'émetteur quand
+//     son buffer est plein) et CTS passe à 1 tant que le terminal
+//     refuse des octets (écriture EAGAIN).
+//
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+
+// Ouvre un nouveau PTY (nomPeriph NULL) ou un périphérique existant.
+// Retourne 0 si OK, -1 en cas d'erreur. Le nom du terminal à ouvrir
+// par l'outil PC est disponible avec SIM_PtyNom().
+int SIM_PtyOuvre(const char *nomPeriph);
+const char *SIM_PtyNom(void);
+
+// Echange avec le terminal : lecture vers la ligne RX simulée,
+// écriture des octets en attente, mise à jour de RTS / CTS.
+void SIM_PtyService(void);
+
+void SIM_PtyFerme(void);
+
+#endif
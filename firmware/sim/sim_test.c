@@ -0,0 +1,38 @@
+// sim_test.c
+// Vérifications communes des programmes de test de la simulation PC
+// CFO 17.10.2026 création
+
+#include <stdio.h>
+#include <stdarg.h>
+#include "sim_test.h"
+
+static uint32_t simNbTests = 0;
+static uint32_t simNbErreurs = 0;
+
+
+int SIM_Verifie(int ok, const char *pFormat, ...)
+{
+    va_list args;
+
+    simNbTests++;
+    if (!ok)
+    {
+        simNbErreurs++;
+        if (simNbErreurs <= SIM_ERREURS_AFFICHEES)
+        {
+            printf("ERREUR ");
+            va_start(args, pFormat);
+            vprintf(pFormat, args);
+            va_end(args);
+            printf("\n");
+        }
+    }
+    return ok;
+}
+
+
+int SIM_Bilan(const char *pNom)
+{
+    printf("%s : %u vérifications, %u erreurs\n", pNom, simNbTests, simNbErreurs);
+    return simNbErreurs ? 1 : 0;
+}
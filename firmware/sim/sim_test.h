@@ -0,0 +1,74 @@
+#ifndef SIM_TEST_H
+#define SIM_TEST_H
+/*--------------------------------------------------------*/
+// sim_test.h
+/*--------------------------------------------------------*/
+//	Description :	outils communs des tests et mesures de la
+//			        simulation PC
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.0
+//	Compilateur	:	gcc / clang (C99)
+//
+//  Générateur xorshift64 : tirages reproductibles pour une graine,
+//  un état par suite de tirages (fonctions inline, sans objet à
+//  lier).
+//
+//  Vérifications (sim_test.c, lié aux programmes tp2_test_xxx) :
+//  SIM_Verifie compte chaque contrôle et affiche les
+//  SIM_ERREURS_AFFICHEES premiers échecs, SIM_Bilan affiche le
+//  total et donne le code de sortie du programme.
+//
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+
+// Nombre d'échecs affichés par SIM_Verifie
+#define SIM_ERREURS_AFFICHEES 10
+
+// Graine non nulle (l'état 0 est un point fixe du xorshift)
+static inline uint64_t SIM_AleaGraine(uint64_t graine)
+{
+    return graine ? graine : 1;
+}
+
+// Tirage suivant, 64 bits
+static inline uint64_t SIM_Alea64(uint64_t *pEtat)
+{
+    uint64_t x = *pEtat;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *pEtat = x;
+    return x;
+}
+
+// Tirage suivant, 32 bits de poids fort
+static inline uint32_t SIM_Alea32(uint64_t *pEtat)
+{
+    return (uint32_t)(SIM_Alea64(pEtat) >> 32);
+}
+
+// Tirage suivant, réel dans [0, 1[ (53 bits)
+static inline double SIM_AleaReel(uint64_t *pEtat)
+{
+    return (SIM_Alea64(pEtat) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*--------------------------------------------------------*/
+// Définition des fonctions prototypes
+/*--------------------------------------------------------*/
+
+// Compte un contrôle ; si ok est nul, compte une erreur et affiche
+// "ERREUR " suivi du message formaté (printf) pour les premières.
+// Retourne ok
+int SIM_Verifie(int ok, const char *pFormat, ...)
+    __attribute__((format(printf, 2, 3)));
+
+// Affiche "<nom> : n vérifications, m erreurs"
+// Retourne le code de sortie : 0 si aucune erreur, 1 sinon
+int SIM_Bilan(const char *pNom);
+
+#endif
@@ -17,33 +17,150 @@
 //   SCA 06.09.2022  v1.7 MPLABX 5.45/xc32 2.50/Harmony 2.06
 //                   Enlev bug dans GetCharFromFifo qui
 //                   empchait un buffer > 256 lments
+//   CFO 17.10.2026  v1.8 ring buffer SPSC, les fonctions du
+//                   fifo deviennent une couche de compatibilit
+//   CFO 17.10.2026  v1.9 criture / lecture par blocs
+//   CFO 17.10.2026  v1.10 peek / commit pour dcodage en place
+//   CFO 17.10.2026  v1.11 InitFifo refuse une taille qui n'est pas
+//                   une puissance de 2 (plus d'arrondi)
 //
 /*--------------------------------------------------------*/
 
+#include <string.h>
 #include "GesFifoTh32.h"
 
+/*-----------*/
+/* SPSC_Init */
+/*===========*/
+
+// Initialisation du descripteur de ring
+// Retourne 0 si OK, 1 si size n'est pas une puissance de 2
+
+uint8_t SPSC_Init ( S_spscRing *pRing, uint32_t size, int8_t *pBuf )
+{
+   // test si size est une puissance de 2
+   if ((size == 0) || ((size & (size - 1)) != 0)) {
+      return (1);
+   }
+   pRing->size = size;
+   pRing->mask = size - 1;
+   pRing->pBuf = pBuf;
+   pRing->head = 0;
+   pRing->tail = 0;
+   return (0);
+} /* SPSC_Init */
+
+
+/*-----------------*/
+/* SPSC_WriteSpace */
+/*=================*/
+
+// Retourne la place disponible en criture
+
+uint32_t SPSC_WriteSpace ( S_spscRing *pRing )
+{
+   uint32_t head = SPSC_LOAD_ACQUIRE(&pRing->head);
+   uint32_t tail = SPSC_LOAD_ACQUIRE(&pRing->tail);
+
+   // la diffrence des index libres donne le remplissage,
+   // mme aprs dbordement des compteurs 32 bits
+   return (pRing->size - (head - tail));
+} /* SPSC_WriteSpace */
+
+
+/*---------------*/
+/* SPSC_ReadSize */
+/*===============*/
+
+// Retourne le nombre de caractres  lire
+
+uint32_t SPSC_ReadSize ( S_spscRing *pRing )
+{
+   uint32_t head = SPSC_LOAD_ACQUIRE(&pRing->head);
+   uint32_t tail = SPSC_LOAD_ACQUIRE(&pRing->tail);
+
+   return (head - tail);
+} /* SPSC_ReadSize */
+
+
+/*--------------*/
+/* SPSC_PutChar */
+/*==============*/
+
+// Dpose un caractre dans le ring (ct producteur uniquement)
+// Retourne 0 si OK, 1 si ring full
+
+uint8_t SPSC_PutChar ( S_spscRing *pRing, int8_t charToPut )
+{
+   // head n'est modifi que par le producteur : lecture simple
+   uint32_t head = pRing->head;
+   uint32_t tail = SPSC_LOAD_ACQUIRE(&pRing->tail);
+
+   // test si ring est FULL
+   if ((head - tail) == pRing->size) {
+      return (1);
+   }
+   // crit le caractre puis publie le nouvel index
+   pRing->pBuf[head & pRing->mask] = charToPut;
+   SPSC_STORE_RELEASE(&pRing->head, head + 1);
+   return (0);
+} /* SPSC_PutChar */
+
+
+/*--------------*/
+/* SPSC_GetChar */
+/*==============*/
+
+// Obtient un caractre du ring (ct consommateur uniquement)
+// retourne 0 si OK, 1 si empty
+
+uint8_t SPSC_GetChar ( S_spscRing *pRing, int8_t *carLu )
+{
+   // tail n'est modifi que par le consommateur : lecture simple
+   uint32_t tail = pRing->tail;
+   uint32_t head = SPSC_LOAD_ACQUIRE(&pRing->head);
+
+   // test si ring est vide
+   if (head == tail) {
+      *carLu = 0;     // carLu = NULL
+      return (1);
+   }
+   // lis le caractre puis libre la place
+   *carLu = pRing->pBuf[tail & pRing->mask];
+   SPSC_STORE_RELEASE(&pRing->tail, tail + 1);
+   return (0);
+} /* SPSC_GetChar */
+
+
 /*---------------*/
 /* InitFifo      */
 /*===============*/
 
 // Init avec possibilit de fournir une valeur de remplissage
 // Initialisation du descripteur de FIFO
+// Retourne 0 si OK, 1 si FifoSize n'est pas une puissance de 2 (le
+// FIFO est alors de taille nulle : toujours vide et toujours plein)
 
-void InitFifo ( S_fifo *pDescrFifo, int32_t FifoSize, int8_t *pDebFifo, int8_t InitVal )
+uint8_t InitFifo ( S_fifo *pDescrFifo, int32_t FifoSize, int8_t *pDebFifo, int8_t InitVal )
 {
    int32_t i;
    int8_t *pFif;
-   pDescrFifo->fifoSize =   FifoSize;
-   pDescrFifo->pDebFifo =   pDebFifo; // dbut du fifo
-   // fin du fifo
-   pDescrFifo->pFinFifo =   pDebFifo + (FifoSize - 1);
-   pDescrFifo->pWrite   =   pDebFifo;  // dbut du fifo
-   pDescrFifo->pRead     =   pDebFifo;  // dbut du fifo
+
+   if ((FifoSize <= 0) || (SPSC_Init(pDescrFifo, (uint32_t)FifoSize, pDebFifo) != 0)) {
+      pDescrFifo->size = 0;
+      pDescrFifo->mask = 0;
+      pDescrFifo->pBuf = pDebFifo;
+      pDescrFifo->head = 0;
+      pDescrFifo->tail = 0;
+      return (1);
+   }
+
    pFif = pDebFifo;
    for (i=0; i < FifoSize; i++) {
       *pFif  = InitVal;
       pFif++;
    }
+   return (0);
 } /* InitFifo */
 
 
@@ -55,14 +172,7 @@ void InitFifo ( S_fifo *pDescrFifo, int32_t FifoSize, int8_t *pDebFifo, int8_t I
 
 int32_t GetWriteSpace ( S_fifo *pDescrFifo)
 {
-   int32_t writeSize;
-
-   // Dtermine le nb de car.que l'on peut dposer
-   writeSize = pDescrFifo->pRead - pDescrFifo->pWrite -1;
-   if (writeSize < 0) {
-      writeSize = writeSize + pDescrFifo->fifoSize;
-    }
-   return (writeSize);
+   return ((int32_t)SPSC_WriteSpace(pDescrFifo));
 } /* GetWriteSpace */
 
 
@@ -74,14 +184,7 @@ int32_t GetWriteSpace ( S_fifo *pDescrFifo)
 
 int32_t GetReadSize ( S_fifo *pDescrFifo)
 {
-   int32_t readSize;
-
-   readSize = pDescrFifo->pWrite - pDescrFifo->pRead;
-   if (readSize < 0) {
-       readSize = readSize +  pDescrFifo->fifoSize;
-   }
-
-   return (readSize);
+   return ((int32_t)SPSC_ReadSize(pDescrFifo));
 } /* GetReadSize */
 
 /*---------------*/
@@ -93,63 +196,155 @@ int32_t GetReadSize ( S_fifo *pDescrFifo)
 
 uint8_t PutCharInFifo ( S_fifo *pDescrFifo, int8_t charToPut )
 {
-   uint8_t writeStatus;
-
-   // test si fifo est FULL
-   if (GetWriteSpace(pDescrFifo) == 0) {
-      writeStatus = 1; // fifo FULL
-   }
-   else {
-      // crit le caractre dans le FIFO
-      *(pDescrFifo->pWrite) = charToPut;
-
-      // incrment le pointeur d'criture
-      pDescrFifo->pWrite++;
-      // gestion du rebouclement
-      if (pDescrFifo->pWrite > pDescrFifo->pFinFifo) {
-          pDescrFifo->pWrite = pDescrFifo->pDebFifo;
-      }
-
-      writeStatus = 0; // OK
-   }
-   return (writeStatus);
-} // PutCharInFifo 
+   return (SPSC_PutChar(pDescrFifo, charToPut));
+} // PutCharInFifo
 
 
 /*-----------------*/
 /* GetCharFromFifo */
 /*=================*/
 
-// Obtient (lecture) un caractre du fifo 
+// Obtient (lecture) un caractre du fifo
 // retourne 0 si OK, 1 si empty
 // le caractre lu est retourn par rference
 
 uint8_t GetCharFromFifo ( S_fifo *pDescrFifo, int8_t *carLu )
 {
-   int32_t readSize;
-   uint8_t readStatus;
+   return (SPSC_GetChar(pDescrFifo, carLu));
+} // GetCharFromFifo
 
-   // dtermine le nb de car. que l'on peut lire
-   readSize = GetReadSize(pDescrFifo);
 
-   // test si fifo est vide
-   if (readSize == 0) {
-      readStatus = 1; // fifo EMPTY
-      *carLu = 0;     // carLu = NULL
+/*----------------*/
+/* PutBlockInFifo */
+/*================*/
+
+// Dpose nbChar caractres dans le FIFO (tout ou rien)
+// Retourne 0 si OK, 1 si place insuffisante (rien n'est crit)
+
+uint8_t PutBlockInFifo ( S_fifo *pDescrFifo, const int8_t *pBlock, uint32_t nbChar )
+{
+   uint32_t head = pDescrFifo->head;
+   uint32_t tail = SPSC_LOAD_ACQUIRE(&pDescrFifo->tail);
+   uint32_t pos, nbAvantFin;
+
+   // test unique de la place disponible
+   if ((pDescrFifo->size - (head - tail)) < nbChar) {
+      return (1);
+   }
+   // copie en 2 morceaux au maximum
+   pos = head & pDescrFifo->mask;
+   nbAvantFin = pDescrFifo->size - pos;
+   if (nbChar <= nbAvantFin) {
+      memcpy(&pDescrFifo->pBuf[pos], pBlock, nbChar);
+   }
+   else {
+      memcpy(&pDescrFifo->pBuf[pos], pBlock, nbAvantFin);
+      memcpy(pDescrFifo->pBuf, pBlock + nbAvantFin, nbChar - nbAvantFin);
+   }
+   // publie tout le bloc en une fois
+   SPSC_STORE_RELEASE(&pDescrFifo->head, head + nbChar);
+   return (0);
+} // PutBlockInFifo
+
+
+/*------------------*/
+/* GetBlockFromFifo */
+/*==================*/
+
+// Obtient nbChar caractres du FIFO (tout ou rien)
+// Retourne 0 si OK, 1 si pas assez de caractres (rien n'est lu)
+
+uint8_t GetBlockFromFifo ( S_fifo *pDescrFifo, int8_t *pBlock, uint32_t nbChar )
+{
+   uint32_t tail = pDescrFifo->tail;
+   uint32_t head = SPSC_LOAD_ACQUIRE(&pDescrFifo->head);
+   uint32_t pos, nbAvantFin;
+
+   // test unique du nombre de caractres disponibles
+   if ((head - tail) < nbChar) {
+      return (1);
+   }
+   // copie en 2 morceaux au maximum
+   pos = tail & pDescrFifo->mask;
+   nbAvantFin = pDescrFifo->size - pos;
+   if (nbChar <= nbAvantFin) {
+      memcpy(pBlock, &pDescrFifo->pBuf[pos], nbChar);
    }
    else {
-      // lis le caractre dans le FIFO
-      *carLu = *(pDescrFifo->pRead);
-
-      // incrment du pointeur de lecture
-      pDescrFifo->pRead++;
-      // gestion du rebouclement
-      if (pDescrFifo->pRead > pDescrFifo->pFinFifo) {
-          pDescrFifo->pRead = pDescrFifo->pDebFifo;
-      }
-      readStatus = 0; // OK
+      memcpy(pBlock, &pDescrFifo->pBuf[pos], nbAvantFin);
+      memcpy(pBlock + nbAvantFin, pDescrFifo->pBuf, nbChar - nbAvantFin);
    }
-   return (readStatus);
-} // GetCharFromFifo 
+   // libre toute la place en une fois
+   SPSC_STORE_RELEASE(&pDescrFifo->tail, tail + nbChar);
+   return (0);
+} // GetBlockFromFifo
 
 
+/*----------*/
+/* PeekFifo */
+/*==========*/
+
+// Donne accs aux caractres  lire sans les consommer
+// Retourne le nombre total de caractres disponibles
+
+uint32_t PeekFifo ( S_fifo *pDescrFifo, S_fifoSpan spans[2] )
+{
+   uint32_t tail = pDescrFifo->tail;
+   uint32_t head = SPSC_LOAD_ACQUIRE(&pDescrFifo->head);
+   uint32_t readSize = head - tail;
+   uint32_t pos = tail & pDescrFifo->mask;
+   uint32_t nbAvantFin = pDescrFifo->size - pos;
+
+   spans[0].pData = &pDescrFifo->pBuf[pos];
+   spans[1].pData = pDescrFifo->pBuf;
+   if (readSize <= nbAvantFin) {
+      spans[0].nbChar = readSize;
+      spans[1].nbChar = 0;
+   }
+   else {
+      spans[0].nbChar = nbAvantFin;
+      spans[1].nbChar = readSize - nbAvantFin;
+   }
+   return (readSize);
+} // PeekFifo
+
+
+/*----------------*/
+/* PeekCharInFifo */
+/*================*/
+
+// Lit un caractre sans le consommer
+// retourne 0 si OK, 1 si offset >= nombre de caractres  lire
+
+uint8_t PeekCharInFifo ( S_fifo *pDescrFifo, uint32_t offset, int8_t *carLu )
+{
+   uint32_t tail = pDescrFifo->tail;
+   uint32_t head = SPSC_LOAD_ACQUIRE(&pDescrFifo->head);
+
+   if (offset >= (head - tail)) {
+      *carLu = 0;
+      return (1);
+   }
+   *carLu = pDescrFifo->pBuf[(tail + offset) & pDescrFifo->mask];
+   return (0);
+} // PeekCharInFifo
+
+
+/*----------------*/
+/* CommitReadFifo */
+/*================*/
+
+// Consomme nbChar caractres dj examins
+// retourne 0 si OK, 1 si nbChar > nombre de caractres  lire
+
+uint8_t CommitReadFifo ( S_fifo *pDescrFifo, uint32_t nbChar )
+{
+   uint32_t tail = pDescrFifo->tail;
+   uint32_t head = SPSC_LOAD_ACQUIRE(&pDescrFifo->head);
+
+   if (nbChar > (head - tail)) {
+      return (1);
+   }
+   SPSC_STORE_RELEASE(&pDescrFifo->tail, tail + nbChar);
+   return (0);
+} // CommitReadFifo
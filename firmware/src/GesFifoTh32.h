@@ -17,6 +17,16 @@
 //   SCA 06.09.2022  v1.7 MPLABX 5.45/xc32 2.50/Harmony 2.06
 //                   Enlev bug dans GetCharFromFifo qui
 //                   empchait un buffer > 256 lments
+//   CFO 17.10.2026  v1.8 ring buffer SPSC (un producteur, un
+//                   consommateur) avec taille puissance de 2,
+//                   index masqus et publication acquire/release.
+//                   S_fifo et ses fonctions restent disponibles
+//                   comme couche de compatibilit.
+//   CFO 17.10.2026  v1.9 PutBlockInFifo / GetBlockFromFifo
+//   CFO 17.10.2026  v1.10 lecture sans consommation (PeekFifo)
+//                   et validation spare (CommitReadFifo)
+//   CFO 17.10.2026  v1.11 InitFifo refuse une taille qui n'est pas
+//                   une puissance de 2 (plus d'arrondi)
 //
 /*--------------------------------------------------------*/
 
@@ -26,14 +36,80 @@
 #include <stdint.h>
 
 
-// structure dcrivant un FIFO
-typedef struct fifo {
-   int32_t fifoSize;   // taille du fifo
-   int8_t *pDebFifo;   // pointeur sur dbut du fifo
-   int8_t *pFinFifo;   // pointeur sur fin du fifo
-   int8_t *pWrite;      // pointeur d'criture
-   int8_t *pRead;      // pointeur de lecture
-} S_fifo;
+// Publication des index entre l'ISR et la boucle principale.
+// L'criture d'un index (release) garantit que les donnes du
+// buffer sont visibles avant le nouvel index, la lecture de
+// l'index de l'autre ct (acquire) garantit l'inverse.
+#define SPSC_LOAD_ACQUIRE(pIdx)        __atomic_load_n((pIdx), __ATOMIC_ACQUIRE)
+#define SPSC_STORE_RELEASE(pIdx, val)  __atomic_store_n((pIdx), (val), __ATOMIC_RELEASE)
+
+// structure dcrivant un ring buffer SPSC
+// Les index head et tail tournent librement sur 32 bits, la
+// position dans le buffer est obtenue par masquage. Le ring
+// peut donc contenir exactement size caractres.
+typedef struct spscRing {
+   uint32_t size;             // taille du ring (puissance de 2)
+   uint32_t mask;             // size - 1
+   int8_t *pBuf;              // pointeur sur dbut du buffer
+   volatile uint32_t head;    // index d'criture (modifi par le producteur seul)
+   volatile uint32_t tail;    // index de lecture (modifi par le consommateur seul)
+} S_spscRing;
+
+// Le descripteur de FIFO historique est un ring SPSC
+typedef S_spscRing S_fifo;
+
+// Morceau contigu du FIFO, obtenu par PeekFifo
+typedef struct {
+   const int8_t *pData;   // pointeur sur le premier caractre
+   uint32_t nbChar;       // nombre de caractres contigus
+} S_fifoSpan;
+
+/*--------------------------------------------------------*/
+/* Dfinition des fonctions du ring SPSC                  */
+/*--------------------------------------------------------*/
+
+/*-----------*/
+/* SPSC_Init */
+/*===========*/
+
+// Initialisation du descripteur de ring
+// Retourne 0 si OK, 1 si size n'est pas une puissance de 2
+
+uint8_t SPSC_Init ( S_spscRing *pRing, uint32_t size, int8_t *pBuf );
+
+/*-----------------*/
+/* SPSC_WriteSpace */
+/*=================*/
+
+// Retourne la place disponible en criture
+
+uint32_t SPSC_WriteSpace ( S_spscRing *pRing );
+
+/*---------------*/
+/* SPSC_ReadSize */
+/*===============*/
+
+// Retourne le nombre de caractres  lire
+
+uint32_t SPSC_ReadSize ( S_spscRing *pRing );
+
+/*--------------*/
+/* SPSC_PutChar */
+/*==============*/
+
+// Dpose un caractre dans le ring (ct producteur uniquement)
+// Retourne 0 si OK, 1 si ring full
+
+uint8_t SPSC_PutChar ( S_spscRing *pRing, int8_t charToPut );
+
+/*--------------*/
+/* SPSC_GetChar */
+/*==============*/
+
+// Obtient un caractre du ring (ct consommateur uniquement)
+// retourne 0 si OK, 1 si empty
+
+uint8_t SPSC_GetChar ( S_spscRing *pRing, int8_t *carLu );
 
 /*--------------------------------------------------------*/
 /* Dfinition des fonctions de gestion du fifo            */
@@ -44,7 +120,9 @@ typedef struct fifo {
 /*===============*/
 
 // Initialisation du descripteur de FIFO
-void InitFifo ( S_fifo *pDescrFifo, int32_t FifoSize, int8_t *pDebFifo, int8_t InitVal );
+// Retourne 0 si OK, 1 si FifoSize n'est pas une puissance de 2 (le
+// FIFO est alors de taille nulle : toujours vide et toujours plein)
+uint8_t InitFifo ( S_fifo *pDescrFifo, int32_t FifoSize, int8_t *pDebFifo, int8_t InitVal );
 
 /*---------------*/
 /* GetWriteSpace */
@@ -81,4 +159,54 @@ uint8_t PutCharInFifo ( S_fifo *pDescrFifo, int8_t charToPut );
 
 uint8_t GetCharFromFifo ( S_fifo *pDescrFifo, int8_t *carLu );
 
+/*----------------*/
+/* PutBlockInFifo */
+/*================*/
+
+// Dpose nbChar caractres dans le FIFO (tout ou rien)
+// La place est teste une seule fois, la copie se fait en au
+// plus 2 morceaux contigus (avant et aprs le rebouclement).
+// Retourne 0 si OK, 1 si place insuffisante (rien n'est crit)
+
+uint8_t PutBlockInFifo ( S_fifo *pDescrFifo, const int8_t *pBlock, uint32_t nbChar );
+
+/*------------------*/
+/* GetBlockFromFifo */
+/*==================*/
+
+// Obtient nbChar caractres du FIFO (tout ou rien)
+// Retourne 0 si OK, 1 si pas assez de caractres (rien n'est lu)
+
+uint8_t GetBlockFromFifo ( S_fifo *pDescrFifo, int8_t *pBlock, uint32_t nbChar );
+
+/*----------*/
+/* PeekFifo */
+/*==========*/
+
+// Donne accs aux caractres  lire sans les consommer
+// spans[0] : du pointeur de lecture jusqu' la fin du buffer
+// spans[1] : depuis le dbut du buffer (nbChar = 0 si pas de rebouclement)
+// Retourne le nombre total de caractres disponibles
+
+uint32_t PeekFifo ( S_fifo *pDescrFifo, S_fifoSpan spans[2] );
+
+/*----------------*/
+/* PeekCharInFifo */
+/*================*/
+
+// Lit le caractre situ offset positions aprs le pointeur de
+// lecture, sans le consommer
+// retourne 0 si OK, 1 si offset >= nombre de caractres  lire
+
+uint8_t PeekCharInFifo ( S_fifo *pDescrFifo, uint32_t offset, int8_t *carLu );
+
+/*----------------*/
+/* CommitReadFifo */
+/*================*/
+
+// Consomme nbChar caractres dj examins par PeekFifo
+// retourne 0 si OK, 1 si nbChar > nombre de caractres  lire
+
+uint8_t CommitReadFifo ( S_fifo *pDescrFifo, uint32_t nbChar );
+
 #endif
@@ -0,0 +1,167 @@
+// Mc32AdcDma.c
+// Acquisition continue des potentiomètres par l'ADC10 et le DMA
+// CFO 17.10.2026 création
+
+#include <stddef.h>
+#include "Mc32AdcDma.h"
+#ifdef __PIC32MX__
+#include <xc.h>
+#include <sys/kmem.h>
+#endif
+
+
+// Blocs perdus (consommés trop tard)
+uint32_t ADCDMA_NbrBlocsPerdus = 0;
+
+// Buffer ping-pong rempli par le DMA (bloc 0 puis bloc 1)
+static uint16_t tampon[2 * ADC_DMA_TAILLE_BLOC];
+
+// Prochain bloc attendu par le consommateur
+static uint8_t blocAttendu = 0;
+
+
+#ifdef __PIC32MX__
+
+// Bit de AD1CSSL / AD1PCFG des entrées balayées
+#define ADC_DMA_ENTREES ((1u << ADC_DMA_AN_CANAL0) | (1u << ADC_DMA_AN_CANAL1))
+
+void ADCDMA_Init(void)
+{
+    blocAttendu = 0;
+
+    // ADC : entier 16 bits, auto-sample + auto-convert, balayage de
+    // ADC_DMA_ENTREES, fin de conversion signalée à chaque résultat
+    // (ADC1BUF0, pointeur remis à 0 à chaque interruption)
+    AD1CON1 = 0;
+    AD1CON1bits.SSRC = 7;
+    AD1CON1bits.ASAM = 1;
+    AD1CON2 = 0;
+    AD1CON2bits.CSCNA = 1;
+    AD1CON2bits.SMPI = 0;
+    AD1CON3 = 0;
+    AD1CON3bits.SAMC = ADC_DMA_SAMC;
+    AD1CON3bits.ADCS = ADC_DMA_ADCS;
+    AD1CHS = 0;
+    AD1CSSL = ADC_DMA_ENTREES;
+    AD1PCFGCLR = ADC_DMA_ENTREES;       // entrées analogiques
+    IFS1CLR = _IFS1_AD1IF_MASK;
+
+    // DMA : 1 cellule de 2 octets par conversion, 2 blocs ping-pong
+    DMACONSET = _DMACON_ON_MASK;
+    DCH3CON = 0;
+    DCH3CONbits.CHAEN = 1;              // réactivation auto en fin de buffer
+    DCH3ECON = 0;
+    DCH3ECONbits.CHSIRQ = _ADC_IRQ;
+    DCH3ECONbits.SIRQEN = 1;
+    DCH3SSA = KVA_TO_PA((void *)&ADC1BUF0);
+    DCH3DSA = KVA_TO_PA(tampon);
+    DCH3SSIZ = 2;
+    DCH3DSIZ = sizeof(tampon) & 0xFF;   // 0 = 256 octets
+    DCH3CSIZ = 2;
+    DCH3INTCLR = 0x00FF00FF;
+    DCH3INTSET = _DCH3INT_CHDHIE_MASK | _DCH3INT_CHBCIE_MASK;
+    DCH3CONSET = _DCH3CON_CHEN_MASK;
+
+    // le balayage démarre sur la première entrée : le buffer commence
+    // toujours par ADC_DMA_AN_CANAL0
+    AD1CON1SET = _AD1CON1_ON_MASK;
+}
+
+// Lit et efface le flag du bloc terminé le plus ancien
+// Retourne 0 (demi-buffer), 1 (fin de buffer) ou 2 (aucun)
+static uint8_t DmaBlocFlag(void)
+{
+    uint32_t flags = DCH3INT;
+
+    // les 2 flags levés : le bloc attendu est le plus ancien
+    if ((flags & _DCH3INT_CHDHIF_MASK) &&
+        (((flags & _DCH3INT_CHBCIF_MASK) == 0) || (blocAttendu == 0)))
+    {
+        DCH3INTCLR = _DCH3INT_CHDHIF_MASK;
+        return 0;
+    }
+    if (flags & _DCH3INT_CHBCIF_MASK)
+    {
+        DCH3INTCLR = _DCH3INT_CHBCIF_MASK;
+        return 1;
+    }
+    return 2;
+}
+
+#else
+
+// Etat du canal DMA simulé
+static uint8_t simActif = 0;
+static uint32_t simPos = 0;
+static uint8_t simFlags = 0;        // bit 0 : demi-buffer, bit 1 : fin
+
+void ADCDMA_Init(void)
+{
+    blocAttendu = 0;
+    simPos = 0;
+    simFlags = 0;
+    simActif = 1;
+}
+
+static uint8_t DmaBlocFlag(void)
+{
+    if ((simFlags & 1) && (((simFlags & 2) == 0) || (blocAttendu == 0)))
+    {
+        simFlags &= ~1;
+        return 0;
+    }
+    if (simFlags & 2)
+    {
+        simFlags &= ~2;
+        return 1;
+    }
+    return 2;
+}
+
+uint8_t ADCDMA_SimConversion(uint16_t valeur)
+{
+    if (simActif == 0)
+    {
+        return 0;
+    }
+    tampon[simPos] = valeur;
+    simPos++;
+    if (simPos == ADC_DMA_TAILLE_BLOC)
+    {
+        simFlags |= 1;
+        return 1;
+    }
+    if (simPos == 2 * ADC_DMA_TAILLE_BLOC)
+    {
+        simPos = 0;
+        simFlags |= 2;
+        return 1;
+    }
+    return 0;
+}
+
+uint8_t ADCDMA_SimCanal(void)
+{
+    return simPos % ADC_DMA_NB_CANAUX;
+}
+
+#endif
+
+
+// Bloc complet le plus ancien, NULL si aucun
+const uint16_t *ADCDMA_BlocTermine(void)
+{
+    uint8_t bloc = DmaBlocFlag();
+
+    if (bloc > 1)
+    {
+        return NULL;
+    }
+    if (bloc != blocAttendu)
+    {
+        // un bloc a été sauté : il a été réécrit par le DMA
+        ADCDMA_NbrBlocsPerdus++;
+    }
+    blocAttendu = bloc ^ 1;
+    return &tampon[bloc * ADC_DMA_TAILLE_BLOC];
+}
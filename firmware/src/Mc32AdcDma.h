@@ -0,0 +1,95 @@
+#ifndef Mc32AdcDma_H
+#define Mc32AdcDma_H
+/*--------------------------------------------------------*/
+// Mc32AdcDma.h
+/*--------------------------------------------------------*/
+//	Description :	acquisition continue des potentiomètres
+//			        par l'ADC10 et le DMA (TP2 PWM&RS232)
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.0
+//	Compilateur	:	XC32 V2.50 + Harmony 2.06
+//
+//  L'ADC balaie AN0 et AN1 en continu (auto-scan, auto-sample,
+//  auto-convert) : une conversion toutes les (SAMC + 12) Tad,
+//  Tad = 2 (ADCS + 1) Tpb, cadence fixe dérivée du quartz et
+//  indépendante de la boucle principale. Le timer 3, seul timer
+//  capable de déclencher l'ADC10, cadence le servo (7 ms) et ne
+//  donnerait que 71 Hz par canal : il n'est pas utilisé.
+//
+//  Chaque fin de conversion déclenche une cellule du canal
+//  DMA_ADC_CHANNEL qui copie ADC1BUF0 dans un buffer de 2 blocs
+//  (ping-pong, rebouclement automatique). L'interruption du
+//  canal (demi-buffer / fin de buffer) signale un bloc complet
+//  pendant que le DMA remplit l'autre : le bloc est consommé
+//  en entier par la chaîne de filtres (Mc32Filtre).
+//
+//  Un bloc contient ADC_DMA_BLOC_ECH échantillons par canal,
+//  entrelacés : AN0, AN1, AN0, AN1...
+//
+//  Hors cible (PC), le DMA est remplacé par un producteur simulé
+//  (ADCDMA_SimConversion) appelé à la cadence des conversions.
+//
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+
+// 1 : acquisition continue ADC + DMA, filtrage par blocs dans
+//     l'interruption du canal DMA
+//     Prévu avec un étage CIC de décimation (voir gestPWM.h :
+//     -DFILTRE_CIC_ORDRE=2 -DFILTRE_CIC_LOG2_R=5) ; sans CIC, la
+//     chaîne par défaut filtre chaque échantillon et sa moyenne ne
+//     couvre que quelques ms
+// 0 : lecture BSP_ReadADCAlt à chaque cycle de la boucle principale
+#ifndef ADC_DMA
+#define ADC_DMA 0
+#endif
+
+// Canal DMA utilisé (0, 1 : USART1, 2 : CRC)
+#define DMA_ADC_CHANNEL 3
+
+// Entrées balayées, dans l'ordre du buffer
+#define ADC_DMA_NB_CANAUX 2
+#define ADC_DMA_AN_CANAL0 0     // potentiomètre vitesse
+#define ADC_DMA_AN_CANAL1 1     // potentiomètre angle
+
+// Horloge de l'ADC : Tad = 2 (ADCS + 1) Tpb = 6.4 us à 80 MHz,
+// échantillonnage SAMC Tad (valeurs maximales : cadence minimale)
+#define ADC_DMA_ADCS 255
+#define ADC_DMA_SAMC 31
+
+// Période d'une conversion (275.2 us, 1817 Hz par canal)
+#define ADC_DMA_PERIODE_NS ((uint32_t)((ADC_DMA_SAMC + 12ull) * 2 * \
+        (ADC_DMA_ADCS + 1) * 1000000000ull / SYS_CLK_BUS_PERIPHERAL_1))
+
+// Echantillons par canal et par bloc (17.6 ms), 2 blocs de
+// 128 octets : DCHxDSIZ limité à 256 octets
+#define ADC_DMA_BLOC_ECH 32
+#define ADC_DMA_TAILLE_BLOC (ADC_DMA_NB_CANAUX * ADC_DMA_BLOC_ECH)
+
+/*--------------------------------------------------------*/
+// Définition des fonctions prototypes
+/*--------------------------------------------------------*/
+
+// Configure l'ADC et le canal DMA puis lance l'acquisition
+// (l'interruption du canal doit être autorisée par l'appelant)
+void ADCDMA_Init(void);
+
+// Appel depuis l'interruption du canal : retourne le bloc complet
+// le plus ancien et acquitte son flag, NULL si aucun
+const uint16_t *ADCDMA_BlocTermine(void);
+
+// Blocs écrasés par le DMA avant d'avoir été consommés
+extern uint32_t ADCDMA_NbrBlocsPerdus;
+
+#ifndef __PIC32MX__
+// Producteur DMA simulé : une conversion du canal suivant du balayage
+// Retourne 1 si un bloc est complet (interruption du canal)
+uint8_t ADCDMA_SimConversion(uint16_t valeur);
+
+// Indice AN du canal de la prochaine conversion (0 .. NB_CANAUX-1)
+uint8_t ADCDMA_SimCanal(void);
+#endif
+
+#endif
@@ -3,44 +3,116 @@
 // Adaptation PIC du programme de Michael Neumann, 14.06.1998
 // Migration pour le PIC32 27.03.2014 C. Huber
 // ATTENTION : Correction de la formule 06.02.2015
+// CFO 17.10.2026 tables gnres  la compilation, option table par quartet
+// CFO 17.10.2026 backends de calcul (tables, gnrateur CRC du DMA)
+// CFO 17.10.2026 calcul DMA asynchrone (CRC16_Lance, CRC16_Termine)
 
 #include "Mc32CalCrc16.h"
+#ifdef __PIC32MX__
+#include <xc.h>
+#include <sys/kmem.h>
+#endif
 
+
+#if (CRC16_SLICE != 1) && (CRC16_SLICE != 4) && (CRC16_SLICE != 8)
+#error "CRC16_SLICE doit valoir 1, 4 ou 8"
+#endif
+
+#if CRC16_TABLE_NIBBLE && (CRC16_SLICE != 1)
+#error "CRC16_TABLE_NIBBLE impose CRC16_SLICE = 1"
+#endif
+
+// Gnration des tables  la compilation
+// --------------------------------------
+// La table k donne le CRC d'un octet suivi de k octets nuls (la table 0
+// est la table classique). Le CRC tant linaire, chaque entre est le
+// XOR des 8 valeurs de base correspondant aux bits  1 de l'index. Les
+// valeurs de base de la table k s'obtiennent en faisant passer un octet
+// nul (8 pas de 1 bit) sur celles de la table k-1.
+
+// Un pas de 1 bit du CRC (polynme 0x1021)
+#define CRC16_BIT(c)     ((((c) << 1) ^ (((c) & 0x8000) ? 0x1021 : 0)) & 0xFFFF)
+// 8 pas : passage d'un octet nul
+#define CRC16_OCTET(c)   CRC16_BIT(CRC16_BIT(CRC16_BIT(CRC16_BIT( \
+                         CRC16_BIT(CRC16_BIT(CRC16_BIT(CRC16_BIT(c))))))))
+
+#define CRC16_BASE_SUIV(k, p) \
+   CRC16_B##k##_0 = CRC16_OCTET(CRC16_B##p##_0), \
+   CRC16_B##k##_1 = CRC16_OCTET(CRC16_B##p##_1), \
+   CRC16_B##k##_2 = CRC16_OCTET(CRC16_B##p##_2), \
+   CRC16_B##k##_3 = CRC16_OCTET(CRC16_B##p##_3), \
+   CRC16_B##k##_4 = CRC16_OCTET(CRC16_B##p##_4), \
+   CRC16_B##k##_5 = CRC16_OCTET(CRC16_B##p##_5), \
+   CRC16_B##k##_6 = CRC16_OCTET(CRC16_B##p##_6), \
+   CRC16_B##k##_7 = CRC16_OCTET(CRC16_B##p##_7)
+
+// Valeurs de base : CRC16_Bk_i = table k, index (1 << i)
+enum {
+   CRC16_B0_0 = CRC16_OCTET(0x0100),
+   CRC16_B0_1 = CRC16_OCTET(0x0200),
+   CRC16_B0_2 = CRC16_OCTET(0x0400),
+   CRC16_B0_3 = CRC16_OCTET(0x0800),
+   CRC16_B0_4 = CRC16_OCTET(0x1000),
+   CRC16_B0_5 = CRC16_OCTET(0x2000),
+   CRC16_B0_6 = CRC16_OCTET(0x4000),
+   CRC16_B0_7 = CRC16_OCTET(0x8000),
+   CRC16_BASE_SUIV(1, 0),
+   CRC16_BASE_SUIV(2, 1),
+   CRC16_BASE_SUIV(3, 2),
+   CRC16_BASE_SUIV(4, 3),
+   CRC16_BASE_SUIV(5, 4),
+   CRC16_BASE_SUIV(6, 5),
+   CRC16_BASE_SUIV(7, 6)
+};
+
+// Entre x de la table k
+#define CRC16_ENTREE(k, x) ( \
+   (((x) & 0x01) ? CRC16_B##k##_0 : 0) ^ (((x) & 0x02) ? CRC16_B##k##_1 : 0) ^ \
+   (((x) & 0x04) ? CRC16_B##k##_2 : 0) ^ (((x) & 0x08) ? CRC16_B##k##_3 : 0) ^ \
+   (((x) & 0x10) ? CRC16_B##k##_4 : 0) ^ (((x) & 0x20) ? CRC16_B##k##_5 : 0) ^ \
+   (((x) & 0x40) ? CRC16_B##k##_6 : 0) ^ (((x) & 0x80) ? CRC16_B##k##_7 : 0) )
+
+#define CRC16_T0(x)  CRC16_ENTREE(0, x)
+#define CRC16_T1(x)  CRC16_ENTREE(1, x)
+#define CRC16_T2(x)  CRC16_ENTREE(2, x)
+#define CRC16_T3(x)  CRC16_ENTREE(3, x)
+#define CRC16_T4(x)  CRC16_ENTREE(4, x)
+#define CRC16_T5(x)  CRC16_ENTREE(5, x)
+#define CRC16_T6(x)  CRC16_ENTREE(6, x)
+#define CRC16_T7(x)  CRC16_ENTREE(7, x)
+
+// Droulement des entres d'une table
+#define CRC16_R4(T, n)   T(n), T((n) + 1), T((n) + 2), T((n) + 3)
+#define CRC16_R16(T, n)  CRC16_R4(T, n), CRC16_R4(T, (n) + 4), \
+                         CRC16_R4(T, (n) + 8), CRC16_R4(T, (n) + 12)
+#define CRC16_R64(T, n)  CRC16_R16(T, n), CRC16_R16(T, (n) + 16), \
+                         CRC16_R16(T, (n) + 32), CRC16_R16(T, (n) + 48)
+#define CRC16_R256(T)    { CRC16_R64(T, 0), CRC16_R64(T, 64), \
+                           CRC16_R64(T, 128), CRC16_R64(T, 192) }
+
+#if CRC16_TABLE_NIBBLE
+// Table calcul CRC16 par quartet (Polynome 0x1021), 32 octets
+// Les 16 entres sont les 16 premires de la table par octet.
+const uint16_t CRC16_nibble[16] = { CRC16_R16(CRC16_T0, 0) };
+#else
 // Table calcul CRC16 (Polynome 0x1021)
-const uint16_t CRC16_table[256] = {
-   0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7, 
-   0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef, 
-   0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6, 
-   0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
-   0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485, 
-   0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d, 
-   0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4, 
-   0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc, 
-   0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823, 
-   0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b, 
-   0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12, 
-   0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
-   0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41, 
-   0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49, 
-   0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70, 
-   0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78, 
-   0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f, 
-   0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
-   0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e, 
-   0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256, 
-   0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
-   0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405, 
-   0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c, 
-   0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634, 
-   0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab, 
-   0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3, 
-   0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a, 
-   0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92, 
-   0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9, 
-   0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1, 
-   0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8, 
-   0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0
+const uint16_t CRC16_table[256] = CRC16_R256(CRC16_T0);
+#endif
+
+#if CRC16_SLICE > 1
+// Tables 1  CRC16_SLICE-1 pour crc16_ccitt (la table 0 est CRC16_table)
+const uint16_t CRC16_slice[CRC16_SLICE - 1][256] = {
+   CRC16_R256(CRC16_T1),
+   CRC16_R256(CRC16_T2),
+   CRC16_R256(CRC16_T3),
+#if CRC16_SLICE == 8
+   CRC16_R256(CRC16_T4),
+   CRC16_R256(CRC16_T5),
+   CRC16_R256(CRC16_T6),
+   CRC16_R256(CRC16_T7),
+#endif
 };
+#endif
 
 // Important : selon spec. CCITT il faut initialiser la valeur du
 // Crc16  0xFFFF
@@ -54,7 +126,341 @@ const uint16_t CRC16_table[256] = {
 
 uint16_t updateCRC16(uint16_t crc, uint8_t data)
 {
+#if CRC16_TABLE_NIBBLE
+    // traitement par quartet, poids fort en premier
+    crc = (crc << 4) ^ CRC16_nibble[((crc >> 12) ^ (data >> 4)) & 0x0F];
+    crc = (crc << 4) ^ CRC16_nibble[((crc >> 12) ^ data) & 0x0F];
+    return crc;
+#else
     // retourne la nouvelle valeur du crc
 	// return (CRC16_table[(crc >> 8) & 0xFF] ^ (crc << 8) ^ data); // Pas OK
     return (CRC16_table[((crc >> 8) & 0xFF) ^ data] ^ (crc << 8) );
+#endif
+}
+
+
+// Fonction pour calcul du CRC16 sur un buffer
+// -------------------------------------------
+
+uint16_t crc16_ccitt(const uint8_t *pData, size_t len, uint16_t init)
+{
+    uint16_t crc = init;
+
+#if CRC16_SLICE == 8
+    // 8 octets par pas : les 2 premiers sont combins avec le CRC courant
+    while (len >= 8) {
+        crc ^= (uint16_t)((pData[0] << 8) | pData[1]);
+        crc = CRC16_slice[6][crc >> 8] ^ CRC16_slice[5][crc & 0xFF] ^
+              CRC16_slice[4][pData[2]] ^ CRC16_slice[3][pData[3]] ^
+              CRC16_slice[2][pData[4]] ^ CRC16_slice[1][pData[5]] ^
+              CRC16_slice[0][pData[6]] ^ CRC16_table[pData[7]];
+        pData += 8;
+        len -= 8;
+    }
+#elif CRC16_SLICE == 4
+    // 4 octets par pas : les 2 premiers sont combins avec le CRC courant
+    while (len >= 4) {
+        crc ^= (uint16_t)((pData[0] << 8) | pData[1]);
+        crc = CRC16_slice[2][crc >> 8] ^ CRC16_slice[1][crc & 0xFF] ^
+              CRC16_slice[0][pData[2]] ^ CRC16_table[pData[3]];
+        pData += 4;
+        len -= 4;
+    }
+#endif
+    // octets restants (ou tout le buffer si CRC16_SLICE == 1)
+    while (len > 0) {
+        crc = updateCRC16(crc, *pData);
+        pData++;
+        len--;
+    }
+    return crc;
+}
+
+
+// Backend logiciel par tables
+// ---------------------------
+
+static uint16_t CRC16_tableResultat;
+static uint8_t CRC16_tablePret = 0;
+
+static void CRC16_TableInit(void)
+{
+    // rien  initialiser, les tables sont en flash
+    CRC16_tablePret = 0;
+}
+
+// Calcul immdiat, le rsultat est rendu par CRC16_TableTermine
+static uint8_t CRC16_TableLance(const uint8_t *pData, size_t len, uint16_t init)
+{
+    CRC16_tableResultat = crc16_ccitt(pData, len, init);
+    CRC16_tablePret = 1;
+    return 0;
+}
+
+static uint8_t CRC16_TableTermine(uint16_t *pCrc)
+{
+    if (CRC16_tablePret == 0) {
+        return 0;
+    }
+    CRC16_tablePret = 0;
+    *pCrc = CRC16_tableResultat;
+    return 1;
+}
+
+const S_crc16Backend CRC16_BackendTable = {
+    CRC16_TableInit, crc16_ccitt, CRC16_TableLance, CRC16_TableTermine
+};
+
+
+// Backend gnrateur CRC du DMA
+// -----------------------------
+
+// Le gnrateur du PIC32MX calcule le CRC sous forme non directe
+// (registre  dcalage "augment") : la valeur initiale doit tre
+// convertie et le message complt par 16 bits nuls pour obtenir le
+// mme rsultat que l'algorithme par tables.
+
+#define CRC16_POLY  0x1021
+
+// Conversion valeur initiale directe -> seed non direct : 16 pas
+// inverses du registre  dcalage (0xFFFF -> 0x84CF)
+static uint16_t CRC16_SeedNonDirect(uint16_t init)
+{
+    uint16_t reg = init;
+    uint8_t i;
+
+    for (i = 0; i < 16; i++) {
+        if (reg & 0x0001) {
+            reg = ((reg ^ CRC16_POLY) >> 1) | 0x8000;
+        }
+        else {
+            reg = reg >> 1;
+        }
+    }
+    return reg;
+}
+
+// Etat du calcul : le message est transmis au gnrateur par blocs de
+// 256 octets au plus, puis le complment de 2 octets nuls
+#define CRC16_DMA_LIBRE       0
+#define CRC16_DMA_MESSAGE     1
+#define CRC16_DMA_COMPLEMENT  2
+
+#define CRC16_DMA_BLOC_MAX    256
+
+static uint8_t CRC16_dmaEtat = CRC16_DMA_LIBRE;
+static const uint8_t *pCrc16DmaData;
+static size_t CRC16_dmaReste;
+
+// 2 octets nuls de complment du message
+static const uint8_t CRC16_zeros[2] = { 0, 0 };
+
+#ifdef __PIC32MX__
+
+// Canal DMA rserv au calcul du CRC
+#define CRC16_DMA_CHANNEL 2
+
+// Destination des transferts, le gnrateur ne garde que le CRC
+static uint8_t CRC16_dmaDummy;
+
+static void CRC16_DmaSeed(uint16_t seed)
+{
+    DCRCDATA = seed;
+}
+
+// Lance le transfert d'un bloc (256 octets max)  travers le
+// gnrateur CRC, sans attendre
+static void CRC16_DmaBlocLance(const uint8_t *pData, uint16_t len)
+{
+    DCH2SSA = KVA_TO_PA(pData);
+    DCH2DSA = KVA_TO_PA(&CRC16_dmaDummy);
+    DCH2SSIZ = len & 0xFF;      // 0 = 256 octets
+    DCH2DSIZ = 1;
+    DCH2CSIZ = len & 0xFF;      // tout le bloc en une cellule
+    DCH2INTCLR = 0x000000FF;    // efface les flags du canal
+    DCH2CONSET = _DCH2CON_CHEN_MASK;
+    DCH2ECONSET = _DCH2ECON_CFORCE_MASK;
+}
+
+// 1 si le bloc lanc est entirement pass par le gnrateur
+static uint8_t CRC16_DmaBlocTermine(void)
+{
+    return DCH2INTbits.CHBCIF;
+}
+
+static uint16_t CRC16_DmaResultat(void)
+{
+    return (uint16_t)DCRCDATA;
+}
+
+static void CRC16_DmaInit(void)
+{
+    CRC16_dmaEtat = CRC16_DMA_LIBRE;
+    DMACONSET = _DMACON_ON_MASK;
+    DCH2CON = 0;                // priorit 0, pas de chanage
+    DCH2ECON = 0;               // dmarrage logiciel uniquement (CFORCE)
+    DCRCCON = 0;
+    DCRCCONbits.PLEN = 15;      // polynme de degr 16
+    DCRCCONbits.CRCCH = CRC16_DMA_CHANNEL;
+    DCRCCONbits.CRCAPP = 0;     // mode background, donnes copies telles quelles
+    DCRCXOR = CRC16_POLY;
+    DCRCCONbits.CRCEN = 1;
+}
+
+#else
+
+// Modle logiciel du gnrateur (PC) : le bloc lanc est trait au
+// premier test de fin de bloc, comme un transfert DMA termin entre
+// deux appels cycliques
+static uint16_t CRC16_dmaModelReg;
+static const uint8_t *pCrc16DmaModelBloc;
+static uint16_t CRC16_dmaModelLen;
+
+// Un pas du registre  dcalage non direct, bit entrant bitIn
+static void CRC16_DmaModelStep(uint8_t bitIn)
+{
+    uint8_t msb = (CRC16_dmaModelReg >> 15) & 1;
+
+    CRC16_dmaModelReg = (uint16_t)((CRC16_dmaModelReg << 1) | bitIn);
+    if (msb) {
+        CRC16_dmaModelReg ^= CRC16_POLY;
+    }
+}
+
+static void CRC16_DmaSeed(uint16_t seed)
+{
+    CRC16_dmaModelReg = seed;
+}
+
+static void CRC16_DmaBlocLance(const uint8_t *pData, uint16_t len)
+{
+    pCrc16DmaModelBloc = pData;
+    CRC16_dmaModelLen = len;
+}
+
+static uint8_t CRC16_DmaBlocTermine(void)
+{
+    int8_t bit;
+
+    // octets du bloc, bit de poids fort en premier
+    while (CRC16_dmaModelLen > 0) {
+        for (bit = 7; bit >= 0; bit--) {
+            CRC16_DmaModelStep((*pCrc16DmaModelBloc >> bit) & 1);
+        }
+        pCrc16DmaModelBloc++;
+        CRC16_dmaModelLen--;
+    }
+    return 1;
+}
+
+static uint16_t CRC16_DmaResultat(void)
+{
+    return CRC16_dmaModelReg;
+}
+
+static void CRC16_DmaInit(void)
+{
+    CRC16_dmaEtat = CRC16_DMA_LIBRE;
+    CRC16_dmaModelReg = 0;
+    CRC16_dmaModelLen = 0;
+}
+
+#endif
+
+// Lance le bloc suivant du message
+static void CRC16_DmaBlocSuivant(void)
+{
+    uint16_t bloc;
+
+    bloc = (CRC16_dmaReste > CRC16_DMA_BLOC_MAX) ?
+           CRC16_DMA_BLOC_MAX : (uint16_t)CRC16_dmaReste;
+    CRC16_DmaBlocLance(pCrc16DmaData, bloc);
+    pCrc16DmaData += bloc;
+    CRC16_dmaReste -= bloc;
+}
+
+static uint8_t CRC16_DmaLance(const uint8_t *pData, size_t len, uint16_t init)
+{
+    if (CRC16_dmaEtat != CRC16_DMA_LIBRE) {
+        return 1;
+    }
+    CRC16_DmaSeed(CRC16_SeedNonDirect(init));
+    if (len > 0) {
+        pCrc16DmaData = pData;
+        CRC16_dmaReste = len;
+        CRC16_dmaEtat = CRC16_DMA_MESSAGE;
+        CRC16_DmaBlocSuivant();
+    }
+    else {
+        CRC16_dmaEtat = CRC16_DMA_COMPLEMENT;
+        CRC16_DmaBlocLance(CRC16_zeros, sizeof(CRC16_zeros));
+    }
+    return 0;
+}
+
+// Avance d'un bloc au plus : le CPU ne fait que relancer le canal
+static uint8_t CRC16_DmaTermine(uint16_t *pCrc)
+{
+    if ((CRC16_dmaEtat == CRC16_DMA_LIBRE) || (CRC16_DmaBlocTermine() == 0)) {
+        return 0;
+    }
+    if (CRC16_dmaEtat == CRC16_DMA_MESSAGE) {
+        if (CRC16_dmaReste > 0) {
+            CRC16_DmaBlocSuivant();
+        }
+        else {
+            CRC16_dmaEtat = CRC16_DMA_COMPLEMENT;
+            CRC16_DmaBlocLance(CRC16_zeros, sizeof(CRC16_zeros));
+        }
+        return 0;
+    }
+    *pCrc = CRC16_DmaResultat();
+    CRC16_dmaEtat = CRC16_DMA_LIBRE;
+    return 1;
+}
+
+// Calcul synchrone : le CPU attend la fin de chaque bloc (environ un
+// cycle de bus par octet). Si un calcul lanc par CRC16_Lance occupe
+// le gnrateur, le calcul se fait par tables.
+static uint16_t CRC16_DmaCompute(const uint8_t *pData, size_t len, uint16_t init)
+{
+    uint16_t crc;
+
+    if (CRC16_DmaLance(pData, len, init) != 0) {
+        return crc16_ccitt(pData, len, init);
+    }
+    while (CRC16_DmaTermine(&crc) == 0) {
+    }
+    return crc;
+}
+
+const S_crc16Backend CRC16_BackendDma = {
+    CRC16_DmaInit, CRC16_DmaCompute, CRC16_DmaLance, CRC16_DmaTermine
+};
+
+
+// Slection du backend
+// --------------------
+
+static const S_crc16Backend *pCrc16Backend = &CRC16_BackendTable;
+
+void CRC16_SelectBackend(const S_crc16Backend *pBackend)
+{
+    pCrc16Backend = pBackend;
+    pCrc16Backend->Init();
+}
+
+uint16_t CRC16_Compute(const uint8_t *pData, size_t len, uint16_t init)
+{
+    return pCrc16Backend->Compute(pData, len, init);
+}
+
+uint8_t CRC16_Lance(const uint8_t *pData, size_t len, uint16_t init)
+{
+    return pCrc16Backend->Lance(pData, len, init);
+}
+
+uint8_t CRC16_Termine(uint16_t *pCrc)
+{
+    return pCrc16Backend->Termine(pCrc);
 }
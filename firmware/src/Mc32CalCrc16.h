@@ -11,6 +11,26 @@
 // ATTENTION : Correction de la formule 06.02.2015
 
 #include <stdint.h>
+#include <stddef.h>
+
+// Table utilise par updateCRC16
+//  0 : table par octet, 256 entres (512 octets de flash)
+//  1 : table par quartet, 16 entres (32 octets de flash), 2 accs par
+//      octet trait ; impose CRC16_SLICE = 1
+#ifndef CRC16_TABLE_NIBBLE
+#define CRC16_TABLE_NIBBLE 0
+#endif
+
+// Choix de l'implmentation de crc16_ccitt  la compilation
+//  1 : byte  byte (table de base seule), dfaut : les messages de
+//      5  23 octets ne gagnent rien au traitement par pas de 4
+//  4 : slice-by-4 (3 tables supplmentaires, 1.5 KB de flash)
+//  8 : slice-by-8 (7 tables supplmentaires, 3.5 KB de flash)
+// 4 ou 8 seulement pour une application qui calcule le CRC de longs
+// buffers (voir 'make bench-crc' du dossier sim)
+#ifndef CRC16_SLICE
+#define CRC16_SLICE 1
+#endif
 
 // Important : selon spec. CCITT il faut initialiser la valeur du
 // Crc16  0xFFFF
@@ -25,4 +45,65 @@
 
 uint16_t updateCRC16(uint16_t crc, uint8_t data);
 
+
+// Fonction pour calcul du CRC16 sur un buffer
+// -------------------------------------------
+
+// Traite len octets  partir de pData, en partant de la valeur init
+// (0xFFFF pour un nouveau message). Selon CRC16_SLICE, 4 ou 8 octets
+// sont traits par pas, les octets restants passent par updateCRC16.
+// Le rsultat est identique  des appels successifs de updateCRC16.
+
+uint16_t crc16_ccitt(const uint8_t *pData, size_t len, uint16_t init);
+
+
+// Backends de calcul du CRC16 sur un buffer
+// -----------------------------------------
+
+// Un backend fournit une initialisation et un calcul sur buffer avec
+// le mme rsultat que crc16_ccitt, en version synchrone (Compute) et
+// en version lancement / rcupration du rsultat (Lance, Termine).
+typedef struct {
+    void (*Init)(void);
+    uint16_t (*Compute)(const uint8_t *pData, size_t len, uint16_t init);
+    uint8_t (*Lance)(const uint8_t *pData, size_t len, uint16_t init);
+    uint8_t (*Termine)(uint16_t *pCrc);
+} S_crc16Backend;
+
+// Backend logiciel par tables (crc16_ccitt)
+// Lance calcule immdiatement, Termine rend le rsultat
+extern const S_crc16Backend CRC16_BackendTable;
+
+// Backend gnrateur CRC du DMA
+// Sur la cible (PIC32MX) : canal DMA CRC16_DMA_CHANNEL en mode
+// "background", blocs de 256 octets au plus puis 2 octets nuls.
+//  - Compute attend la fin de chaque bloc : le CPU est bloqu pendant
+//    le transfert (environ un cycle de bus par octet).
+//  - Lance dmarre le premier bloc et rend la main ; Termine, appel
+//    cycliquement (APP_Tasks), relance le bloc suivant quand le
+//    prcdent est termin et rend le CRC  la fin. Le calcul se fait
+//    alors hors CPU,  raison d'un bloc par appel de Termine.
+// Un seul calcul  la fois : Lance retourne 1 si le gnrateur est
+// occup, Compute passe alors par crc16_ccitt.
+// Sur PC : modle logiciel bit  bit du gnrateur (LFSR non direct,
+// seed converti et message complt par 16 bits nuls), pour tester
+// le backend contre l'implmentation par tables.
+extern const S_crc16Backend CRC16_BackendDma;
+
+// Slection du backend utilis par CRC16_Compute (table par dfaut),
+// appelle l'Init du backend choisi
+void CRC16_SelectBackend(const S_crc16Backend *pBackend);
+
+// Calcul du CRC16 d'un buffer avec le backend slectionn
+uint16_t CRC16_Compute(const uint8_t *pData, size_t len, uint16_t init);
+
+// Lance le calcul du CRC16 d'un buffer avec le backend slectionn
+// (le buffer doit rester valide jusqu'au rsultat)
+// Retourne 0 si lanc, 1 si un calcul est dj en cours
+uint8_t CRC16_Lance(const uint8_t *pData, size_t len, uint16_t init);
+
+// Appel cyclique aprs CRC16_Lance : retourne 1 et le CRC dans *pCrc
+// quand le calcul est termin, 0 sinon
+uint8_t CRC16_Termine(uint16_t *pCrc);
+
 #endif
\ No newline at end of file
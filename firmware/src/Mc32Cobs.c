@@ -0,0 +1,96 @@
+// Mc32Cobs.c
+// Encodage COBS des trames de la liaison série
+// CFO 17.10.2026 création
+
+#include "Mc32Cobs.h"
+
+
+uint32_t COBS_Encode(const int8_t *pSrc, uint32_t nbChar, int8_t *pDest)
+{
+    uint32_t iCode = 0;     // position du code du bloc en cours
+    uint32_t iDest = 1;
+    uint8_t code = 1;
+    uint32_t i;
+
+    for (i = 0; i < nbChar; i++)
+    {
+        if (pSrc[i] != COBS_DELIMITEUR)
+        {
+            pDest[iDest++] = pSrc[i];
+            code++;
+        }
+        // 0x00 dans la trame ou bloc plein : le bloc est fermé
+        if ((pSrc[i] == COBS_DELIMITEUR) || (code == 0xFF))
+        {
+            pDest[iCode] = code;
+            iCode = iDest++;
+            code = 1;
+        }
+    }
+    pDest[iCode] = code;
+    return iDest;
+}
+
+
+void COBS_DecodeInit(S_cobsDecodeur *pDec, int8_t *pDest, uint8_t tailleMax)
+{
+    pDec->pDest = pDest;
+    pDec->tailleMax = tailleMax;
+    pDec->nb = 0;
+    pDec->reste = 0;
+    pDec->code = 0;
+    pDec->erreur = 0;
+}
+
+
+E_cobsResultat COBS_DecodeOctet(S_cobsDecodeur *pDec, int8_t octet)
+{
+    E_cobsResultat resultat = COBS_EN_COURS;
+
+    if (pDec->code == 0)
+    {
+        // début de trame
+        pDec->nb = 0;
+        pDec->erreur = 0;
+    }
+    if (octet == COBS_DELIMITEUR)
+    {
+        if (pDec->code != 0)
+        {
+            resultat = ((pDec->reste == 0) && (pDec->erreur == 0)) ? COBS_TRAME : COBS_ERREUR;
+        }
+        pDec->code = 0;
+        pDec->reste = 0;
+        return resultat;
+    }
+    if (pDec->reste == 0)
+    {
+        // nouveau bloc : 0x00 implicite après un bloc non plein
+        if ((pDec->code != 0) && (pDec->code != 0xFF))
+        {
+            if (pDec->nb < pDec->tailleMax)
+            {
+                pDec->pDest[pDec->nb++] = 0;
+            }
+            else
+            {
+                pDec->erreur = 1;
+            }
+        }
+        pDec->code = (uint8_t)octet;
+        pDec->reste = (uint8_t)octet - 1;
+    }
+    else
+    {
+        if (pDec->nb < pDec->tailleMax)
+        {
+            pDec->pDest[pDec->nb++] = octet;
+        }
+        else
+        {
+            pDec->erreur = 1;
+        }
+        pDec->reste--;
+    }
+    return resultat;
+}
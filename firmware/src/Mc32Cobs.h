@@ -0,0 +1,61 @@
+#ifndef Mc32Cobs_H
+#define Mc32Cobs_H
+/*--------------------------------------------------------*/
+// Mc32Cobs.h
+/*--------------------------------------------------------*/
+//	Description :	encodage COBS (Consistent Overhead Byte
+//			        Stuffing) des trames de la liaison série
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.0
+//	Compilateur	:	XC32 V2.50 + Harmony 2.06
+//
+//  Une trame encodée ne contient aucun octet 0x00 : chaque bloc
+//  commence par un code = 1 + nombre d'octets non nuls qui le
+//  suivent, un 0x00 implicite termine chaque bloc de code < 0xFF
+//  (sauf le dernier). Le 0x00 sert de délimiteur de fin de trame
+//  sur la ligne, la resynchronisation se fait au délimiteur
+//  suivant. Surcoût : 1 octet par tranche de 254 octets.
+//
+//  Le décodage se fait octet par octet, sans retour en arrière :
+//  les octets peuvent être consommés au fur et à mesure.
+//
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+
+#define COBS_DELIMITEUR 0x00
+// Taille encodée maximale de nbChar octets (délimiteur non compris)
+#define COBS_TAILLE_ENCODEE(nbChar) ((nbChar) + ((nbChar) / 254) + 1)
+
+// Résultat du décodage d'un octet
+typedef enum {
+    COBS_EN_COURS = 0,  // octet de la trame, ou délimiteur sans trame
+    COBS_TRAME,         // délimiteur, trame complète (nb octets décodés)
+    COBS_ERREUR,        // délimiteur, trame incomplète ou trop longue
+} E_cobsResultat;
+
+// Contexte du décodeur, conservé d'un octet à l'autre
+typedef struct {
+    int8_t *pDest;      // trame décodée
+    uint8_t tailleMax;  // taille de pDest
+    uint8_t nb;         // octets décodés
+    uint8_t reste;      // octets restant dans le bloc en cours
+    uint8_t code;       // code du bloc en cours (0 : début de trame)
+    uint8_t erreur;     // trame trop longue, ignorée jusqu'au délimiteur
+} S_cobsDecodeur;
+
+// Encode nbChar octets de pSrc dans pDest (COBS_TAILLE_ENCODEE(nbChar)
+// octets au plus, sans délimiteur). Retourne la taille encodée.
+uint32_t COBS_Encode(const int8_t *pSrc, uint32_t nbChar, int8_t *pDest);
+
+// Prépare le décodage d'une trame dans pDest
+void COBS_DecodeInit(S_cobsDecodeur *pDec, int8_t *pDest, uint8_t tailleMax);
+
+// Décode un octet reçu. Après COBS_TRAME ou COBS_ERREUR le décodeur
+// est prêt pour la trame suivante (pDec->nb remis à zéro à l'octet
+// suivant).
+E_cobsResultat COBS_DecodeOctet(S_cobsDecodeur *pDec, int8_t octet);
+
+#endif
@@ -0,0 +1,131 @@
+// Mc32ConvPwm.c
+// Conversions en virgule fixe ADC -> consigne -> largeur d'impulsion
+// CFO 17.10.2026 création
+// CFO 17.10.2026 table de l'impulsion du servo (calibration)
+// CFO 17.10.2026 calibration sauvegardée en flash (Mc32Nvm)
+// CFO 17.10.2026 sauvegarde sur demande seulement (CONV_CalibSauve)
+
+#include "Mc32ConvPwm.h"
+#include "Mc32Nvm.h"
+
+
+S_convFacteurs CONV_Facteurs;
+uint16_t CONV_TableOc3[CONV_NB_ANGLES];
+
+// Calibration de la table (valide après CONV_Init)
+static S_convCalib calibServo;
+static const S_convCalib calibDefaut = {
+    CONV_OC3_MIN_DEFAUT, CONV_OC3_MAX_DEFAUT, 0
+};
+
+// Facteur num / den avec q bits fractionnaires, arrondi par excès
+static uint32_t Facteur(uint32_t num, uint32_t den, uint8_t q)
+{
+    return (uint32_t)((((uint64_t)num << q) + den - 1) / den);
+}
+
+
+// Impulsion OC3 de l'entrée i (angle + 90) de la table
+static int32_t ImpulsionOc3(const S_convCalib *pCalib, int32_t i)
+{
+    return pCalib->oc3Min
+           + (((int32_t)pCalib->oc3Max - pCalib->oc3Min) * i) / (CONV_NB_ANGLES - 1)
+           + ((int32_t)pCalib->oc3Courbure * i * (CONV_NB_ANGLES - 1 - i))
+             / (CONV_ANGLE_MAX * CONV_ANGLE_MAX);
+}
+
+
+// Retourne 1 si toute la table de la calibration reste dans
+// 0..CONV_OC3_LIMITE
+static uint8_t CalibValide(const S_convCalib *pCalib)
+{
+    int32_t i, oc3;
+
+    for (i = 0; i < CONV_NB_ANGLES; i++)
+    {
+        oc3 = ImpulsionOc3(pCalib, i);
+        if ((oc3 < 0) || (oc3 > CONV_OC3_LIMITE))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+// Construction de la table (calibration contrôlée)
+static void ConstruitTable(const S_convCalib *pCalib)
+{
+    int32_t i;
+
+    for (i = 0; i < CONV_NB_ANGLES; i++)
+    {
+        CONV_TableOc3[i] = ImpulsionOc3(pCalib, i);
+    }
+}
+
+
+void CONV_Init(uint32_t periode)
+{
+    CONV_Facteurs.kVitesse = Facteur(2 * CONV_VITESSE_MAX, CONV_ADC_MAX, CONV_Q_ADC);
+    CONV_Facteurs.kAngle = Facteur(2 * CONV_ANGLE_MAX, CONV_ADC_MAX, CONV_Q_ADC);
+    CONV_Facteurs.periode = 0;
+    CONV_PeriodeSet(periode);
+
+    // calibration sauvegardée si présente et valide, sinon défaut
+    if ((NVM_ParamLire(&calibServo, sizeof(calibServo)) != 0) ||
+        (CalibValide(&calibServo) == 0))
+    {
+        calibServo = calibDefaut;
+    }
+    ConstruitTable(&calibServo);
+}
+
+
+void CONV_PeriodeSet(uint32_t periode)
+{
+    if (periode != CONV_Facteurs.periode)
+    {
+        CONV_Facteurs.kOc2 = Facteur(periode, 100, CONV_Q_OC);
+        CONV_Facteurs.periode = periode;
+    }
+}
+
+
+uint8_t CONV_CalibSet(const S_convCalib *pCalib)
+{
+    if ((pCalib->oc3Min == calibServo.oc3Min) && (pCalib->oc3Max == calibServo.oc3Max) &&
+        (pCalib->oc3Courbure == calibServo.oc3Courbure))
+    {
+        return 0;
+    }
+    // toute la table est contrôlée avant d'être modifiée
+    if (CalibValide(pCalib) == 0)
+    {
+        return 1;
+    }
+    calibServo = *pCalib;
+    ConstruitTable(&calibServo);
+    return 0;
+}
+
+
+uint8_t CONV_CalibSauve(void)
+{
+    S_convCalib calibFlash;
+
+    // pas d'effacement si la flash est à jour (usure de la page)
+    if ((NVM_ParamLire(&calibFlash, sizeof(calibFlash)) == 0) &&
+        (calibFlash.oc3Min == calibServo.oc3Min) && (calibFlash.oc3Max == calibServo.oc3Max) &&
+        (calibFlash.oc3Courbure == calibServo.oc3Courbure))
+    {
+        return 0;
+    }
+    return NVM_ParamEcrire(&calibServo, sizeof(calibServo));
+}
+
+
+const S_convCalib *CONV_CalibGet(void)
+{
+    return &calibServo;
+}
@@ -0,0 +1,143 @@
+#ifndef Mc32ConvPwm_H
+#define Mc32ConvPwm_H
+/*--------------------------------------------------------*/
+// Mc32ConvPwm.h
+/*--------------------------------------------------------*/
+//	Description :	conversions en virgule fixe ADC -> consigne
+//			        et consigne -> largeur d'impulsion (OC)
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.1
+//	Compilateur	:	XC32 V2.50 + Harmony 2.06
+//
+//  Chaque conversion est une multiplication 32 bits par un facteur
+//  en virgule fixe suivie d'un décalage, sans division ni calcul
+//  en virgule flottante (pas de FPU sur le PIC32MX). Les facteurs
+//  sont arrondis par excès : le résultat est identique à la
+//  division entière d'origine tant que l'erreur accumulée
+//  (x / 2^Q) reste sous le plus petit écart entre un reste de la
+//  division et l'entier suivant (1 / den) :
+//   - ADC : /1023 = /341 après simplification, x <= 1023 : Q20
+//     (Q16 donnerait jusqu'à 1/64 d'erreur, > 1/341)
+//   - OC2 : /100, x <= 99 : Q16
+//  Les produits restent sur 32 bits (timer 2 : période 16 bits).
+//
+//  Formules reproduites :
+//   vitesse = (198 * adc) / 1023 - 99         adc 0..1023
+//   angle   = (180 * adc) / 1023 - 90         adc 0..1023
+//   OC2     = (|vitesse| * période) / 100     période du timer 2
+//
+//  Le facteur de OC2 dépend de la période du timer 2 : il est
+//  recalculé par CONV_PeriodeSet à chaque changement de période,
+//  la période n'est plus relue à chaque cycle.
+//
+//  Servo : table de 181 impulsions OC3 indexée par angle + 90,
+//  construite depuis la calibration du servo (impulsions à -90 et
+//  +90, correction de courbure) et reconstruite seulement quand
+//  la calibration change (CONV_CalibSet, aussi par la liaison
+//  série, en RAM seulement). CONV_CalibSauve écrit la calibration
+//  active en flash (Mc32Nvm) sur demande explicite, une fois le
+//  réglage terminé : CONV_Init recharge la dernière calibration
+//  sauvegardée. Pour i = angle + 90 :
+//   OC3 = min + ((max - min) * i) / 180
+//             + (courbure * i * (180 - i)) / 8100
+//  La courbure est l'écart ajouté au milieu (angle 0), parabolique
+//  et nulle aux extrémités. La calibration par défaut (2999, 11999,
+//  0) donne ((angle + 90) * 9000) / 180 + 2999.
+//
+//  CFO 17.10.2026 table de l'impulsion du servo (calibration)
+//  CFO 17.10.2026 calibration sauvegardée en flash
+//  CFO 17.10.2026 sauvegarde sur demande seulement (CONV_CalibSauve)
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+
+// Valeur maximale de l'ADC (10 bits)
+#define CONV_ADC_MAX 1023
+
+// Plages des consignes
+#define CONV_VITESSE_MAX 99
+#define CONV_ANGLE_MAX 90
+
+// Calibration par défaut du servo (ticks du timer 3) : angle -90 et +90
+#define CONV_OC3_MIN_DEFAUT 2999
+#define CONV_OC3_MAX_DEFAUT 11999
+// Impulsion maximale : période du timer 3
+#define CONV_OC3_LIMITE 34999
+// Nombre d'entrées de la table, angle -90..90
+#define CONV_NB_ANGLES (2 * CONV_ANGLE_MAX + 1)
+
+// Bits fractionnaires des facteurs
+#define CONV_Q_ADC 20
+#define CONV_Q_OC 16
+
+// Facteurs des conversions
+typedef struct {
+    uint32_t kVitesse;      // 2 * VITESSE_MAX / ADC_MAX, Q20
+    uint32_t kAngle;        // 2 * ANGLE_MAX / ADC_MAX, Q20
+    uint32_t kOc2;          // période / 100, Q16
+    uint32_t periode;       // période du timer 2 de kOc2
+} S_convFacteurs;
+
+// Calibration du servo
+typedef struct {
+    uint16_t oc3Min;        // impulsion à -90
+    uint16_t oc3Max;        // impulsion à +90
+    int16_t oc3Courbure;    // écart ajouté à 0 (parabole)
+} S_convCalib;
+
+extern S_convFacteurs CONV_Facteurs;
+extern uint16_t CONV_TableOc3[CONV_NB_ANGLES];
+
+/*--------------------------------------------------------*/
+// Définition des fonctions prototypes
+/*--------------------------------------------------------*/
+
+// Facteurs fixes, facteur de OC2 pour la période du timer 2 et table
+// du servo pour la calibration sauvegardée (défaut si absente ou
+// invalide)
+void CONV_Init(uint32_t periode);
+
+// Nouvelle calibration du servo (RAM) : si elle change, la table est
+// reconstruite. Retourne 0 si OK, 1 si une impulsion de la table
+// sortirait de 0..CONV_OC3_LIMITE (calibration et table inchangées)
+uint8_t CONV_CalibSet(const S_convCalib *pCalib);
+
+// Sauvegarde de la calibration active en flash (pas d'écriture si la
+// flash contient déjà la même). Efface une page de flash : CPU arrêté
+// ~20 ms, à réserver à la fin d'un réglage (voir Mc32Nvm.h).
+// Retourne 0 si OK, 1 si erreur d'écriture
+uint8_t CONV_CalibSauve(void);
+
+// Calibration active du servo
+const S_convCalib *CONV_CalibGet(void);
+
+// Recalcule le facteur de OC2 si la période du timer 2 a changé
+void CONV_PeriodeSet(uint32_t periode);
+
+// ADC (0..1023) -> vitesse 0..198 (soustraire CONV_VITESSE_MAX)
+static inline uint32_t CONV_AdcVitesse(uint32_t adc)
+{
+    return (adc * CONV_Facteurs.kVitesse) >> CONV_Q_ADC;
+}
+
+// ADC (0..1023) -> angle 0..180 (soustraire CONV_ANGLE_MAX)
+static inline uint32_t CONV_AdcAngle(uint32_t adc)
+{
+    return (adc * CONV_Facteurs.kAngle) >> CONV_Q_ADC;
+}
+
+// |vitesse| (0..99) -> largeur d'impulsion OC2
+static inline uint16_t CONV_VitesseOc2(uint32_t absVitesse)
+{
+    return (absVitesse * CONV_Facteurs.kOc2) >> CONV_Q_OC;
+}
+
+// angle (-90..90) -> largeur d'impulsion OC3 (table calibrée)
+static inline uint16_t CONV_AngleOc3(int32_t angle)
+{
+    return CONV_TableOc3[angle + CONV_ANGLE_MAX];
+}
+
+#endif
@@ -0,0 +1,324 @@
+// Mc32DmaUart.c
+// Transferts DMA entre l'USART1 et les fifos de communication
+// CFO 17.10.2026 réception DMA dans le fifo RX
+// CFO 17.10.2026 émission DMA par morceaux contigus du fifo TX
+
+#include "Mc32DmaUart.h"
+#ifdef __PIC32MX__
+#include <xc.h>
+#include <sys/kmem.h>
+#endif
+
+
+// Octets perdus (écrasés par le DMA avant lecture)
+uint32_t DMAUART_RxNbrPerdus = 0;
+
+// Dernière position du pointeur d'écriture DMA traitée
+static uint32_t rxDernierePos = 0;
+
+// Etat du canal d'émission
+static volatile uint8_t txEnCours = 0;     // un morceau est confié au DMA
+static volatile uint8_t txSuspendu = 0;    // transfert suspendu par le CTS
+static volatile uint32_t txNbEnCours = 0;  // taille du morceau en cours
+
+
+#ifdef __PIC32MX__
+
+// Pointeur d'écriture courant du canal RX (0 .. taille-1)
+static uint32_t DmaRxPosGet(void)
+{
+    return DCH0DPTR;
+}
+
+// Lit et efface le flag de fin de bloc (rebouclement du buffer)
+static uint8_t DmaRxBlocTermine(void)
+{
+    if (DCH0INTbits.CHBCIF)
+    {
+        DCH0INTCLR = _DCH0INT_CHBCIF_MASK;
+        return 1;
+    }
+    return 0;
+}
+
+uint8_t DMAUART_RxInit(S_fifo *pFifo)
+{
+    if (pFifo->size > DMA_UART_BLOC_MAX)
+    {
+        return 1;
+    }
+    rxDernierePos = 0;
+
+    DMACONSET = _DMACON_ON_MASK;
+    DCH0CON = 0;
+    DCH0CONbits.CHAEN = 1;              // réactivation auto en fin de bloc
+    DCH0ECON = 0;
+    DCH0ECONbits.CHSIRQ = _UART1_RX_IRQ; // 1 cellule par octet reçu
+    DCH0ECONbits.SIRQEN = 1;
+    DCH0SSA = KVA_TO_PA((void *)&U1RXREG);
+    DCH0DSA = KVA_TO_PA(pFifo->pBuf);
+    DCH0SSIZ = 1;
+    DCH0DSIZ = pFifo->size & 0xFF;      // 0 = 256 octets
+    DCH0CSIZ = 1;
+    DCH0INTCLR = 0x00FF00FF;            // flags et enables d'interruption
+    DCH0CONSET = _DCH0CON_CHEN_MASK;
+    return 0;
+}
+
+void DMAUART_TxInit(void)
+{
+    txEnCours = 0;
+    txSuspendu = 0;
+
+    DMACONSET = _DMACON_ON_MASK;
+    DCH1CON = 0;
+    DCH1ECON = 0;
+    DCH1ECONbits.CHSIRQ = _UART1_TX_IRQ; // 1 cellule par place libre
+    DCH1ECONbits.SIRQEN = 1;
+    DCH1DSA = KVA_TO_PA((void *)&U1TXREG);
+    DCH1DSIZ = 1;
+    DCH1CSIZ = 1;
+    DCH1INTCLR = 0x00FF00FF;
+    DCH1INTSET = _DCH1INT_CHBCIE_MASK;  // interruption de fin de bloc
+}
+
+// Lance le transfert d'un morceau contigu
+static void DmaTxLance(const int8_t *pData, uint32_t nbChar)
+{
+    DCH1SSA = KVA_TO_PA((void *)pData);
+    DCH1SSIZ = nbChar & 0xFF;           // 0 = 256 octets
+    DCH1INTCLR = 0x000000FF;
+    DCH1CONSET = _DCH1CON_CHEN_MASK;
+    // premier octet forcé, les suivants sur place libre dans l'USART
+    DCH1ECONSET = _DCH1ECON_CFORCE_MASK;
+}
+
+static void DmaTxSuspend(void)
+{
+    DCH1CONCLR = _DCH1CON_CHEN_MASK;
+}
+
+// L'USART ne signale la place libre qu'au passage à vide du buffer HW
+// (USART_TRANSMIT_FIFO_EMPTY) : s'il s'est vidé pendant la suspension,
+// aucun événement ne viendra, la reprise force donc une cellule
+static void DmaTxReprend(void)
+{
+    DCH1CONSET = _DCH1CON_CHEN_MASK;
+    if (U1STAbits.UTXBF == 0)
+    {
+        DCH1ECONSET = _DCH1ECON_CFORCE_MASK;
+    }
+}
+
+static void DmaTxAcquitte(void)
+{
+    DCH1INTCLR = 0x000000FF;
+}
+
+#else
+
+// Etat du canal DMA simulé
+static S_fifo *pSimFifo = 0;
+static uint32_t simPos = 0;
+static uint8_t simBlocTermine = 0;
+
+static uint32_t DmaRxPosGet(void)
+{
+    return simPos;
+}
+
+static uint8_t DmaRxBlocTermine(void)
+{
+    uint8_t termine = simBlocTermine;
+
+    simBlocTermine = 0;
+    return termine;
+}
+
+uint8_t DMAUART_RxInit(S_fifo *pFifo)
+{
+    if (pFifo->size > DMA_UART_BLOC_MAX)
+    {
+        return 1;
+    }
+    rxDernierePos = 0;
+    pSimFifo = pFifo;
+    simPos = 0;
+    simBlocTermine = 0;
+    return 0;
+}
+
+// Canal d'émission simulé
+static const int8_t *pSimTxData = 0;
+
+void DMAUART_TxInit(void)
+{
+    txEnCours = 0;
+    txSuspendu = 0;
+    pSimTxData = 0;
+}
+
+static void DmaTxLance(const int8_t *pData, uint32_t nbChar)
+{
+    (void)nbChar;
+    pSimTxData = pData;
+}
+
+static void DmaTxSuspend(void)
+{
+}
+
+static void DmaTxReprend(void)
+{
+}
+
+static void DmaTxAcquitte(void)
+{
+}
+
+// Producteur DMA simulé : une cellule d'un octet par caractère reçu,
+// le DMA écrit sans tenir compte de la place libre du fifo
+void DMAUART_SimRxBytes(const int8_t *pData, uint32_t nbChar)
+{
+    while (nbChar > 0)
+    {
+        pSimFifo->pBuf[simPos] = *pData;
+        simPos++;
+        if (simPos >= pSimFifo->size)
+        {
+            simPos = 0;
+            simBlocTermine = 1;
+        }
+        pData++;
+        nbChar--;
+    }
+}
+
+// Consommateur DMA simulé : le morceau en cours est émis en entier
+uint32_t DMAUART_SimTxTransfert(S_fifo *pFifo, int8_t *pDest,
+                                uint8_t emissionAutorisee)
+{
+    uint32_t nbEmis;
+    uint32_t i;
+
+    if ((txEnCours == 0) || txSuspendu)
+    {
+        return 0;
+    }
+    nbEmis = txNbEnCours;
+    for (i = 0; i < nbEmis; i++)
+    {
+        pDest[i] = pSimTxData[i];
+    }
+    DMAUART_TxBlocTermine(pFifo, emissionAutorisee);
+    return nbEmis;
+}
+
+#endif
+
+
+// Publie dans le fifo les octets écrits par le DMA depuis le dernier appel
+uint32_t DMAUART_RxUpdate(S_fifo *pFifo)
+{
+    uint8_t rebouclement;
+    uint32_t pos, nbNouveaux;
+    uint32_t head, tail;
+
+    // Le nombre d'octets est donné par le pointeur seul. Le flag de fin
+    // de bloc, lu avant le pointeur, ne sert qu'à détecter un tour
+    // complet que le pointeur ne peut pas voir (pos >= rxDernierePos).
+    rebouclement = DmaRxBlocTermine();
+    pos = DmaRxPosGet();
+
+    if (pos < rxDernierePos)
+    {
+        nbNouveaux = (pFifo->size - rxDernierePos) + pos;
+        if (rebouclement == 0)
+        {
+            // rebouclement entre la lecture du flag et celle du pointeur :
+            // il est déjà compté, son flag ne doit pas l'être à l'appel
+            // suivant
+            (void)DmaRxBlocTermine();
+        }
+    }
+    else
+    {
+        nbNouveaux = pos - rxDernierePos;
+        if (rebouclement)
+        {
+            // un tour complet depuis le dernier appel (dépassement)
+            nbNouveaux += pFifo->size;
+        }
+    }
+    rxDernierePos = pos;
+
+    head = pFifo->head + nbNouveaux;
+    tail = pFifo->tail;
+    if ((head - tail) > pFifo->size)
+    {
+        // le DMA a écrasé des octets non lus : ils sont abandonnés
+        DMAUART_RxNbrPerdus += (head - tail) - pFifo->size;
+        SPSC_STORE_RELEASE(&pFifo->tail, head - pFifo->size);
+    }
+    SPSC_STORE_RELEASE(&pFifo->head, head);
+    return nbNouveaux;
+}
+
+
+// Confie au DMA le prochain morceau contigu du fifo d'émission
+static void TxLanceSuivant(S_fifo *pFifo)
+{
+    S_fifoSpan spans[2];
+
+    if (PeekFifo(pFifo, spans) == 0)
+    {
+        txEnCours = 0;
+        return;
+    }
+    txNbEnCours = spans[0].nbChar;
+    if (txNbEnCours > DMA_UART_BLOC_MAX)
+    {
+        txNbEnCours = DMA_UART_BLOC_MAX;
+    }
+    txEnCours = 1;
+    DmaTxLance(spans[0].pData, txNbEnCours);
+}
+
+
+// Appel cyclique : démarrage, suspension et reprise de l'émission
+void DMAUART_TxDemarre(S_fifo *pFifo, uint8_t emissionAutorisee)
+{
+    if (txEnCours)
+    {
+        // contrôle de flux : le transfert en cours est suspendu tant
+        // que le CTS interdit l'émission
+        if ((emissionAutorisee == 0) && (txSuspendu == 0))
+        {
+            DmaTxSuspend();
+            txSuspendu = 1;
+        }
+        else if (emissionAutorisee && txSuspendu)
+        {
+            txSuspendu = 0;
+            DmaTxReprend();
+        }
+    }
+    else if (emissionAutorisee)
+    {
+        TxLanceSuivant(pFifo);
+    }
+}
+
+
+// Fin de bloc : le morceau émis est consommé, le suivant est lancé
+void DMAUART_TxBlocTermine(S_fifo *pFifo, uint8_t emissionAutorisee)
+{
+    DmaTxAcquitte();
+    CommitReadFifo(pFifo, txNbEnCours);
+    txNbEnCours = 0;
+    txEnCours = 0;
+    if (emissionAutorisee)
+    {
+        TxLanceSuivant(pFifo);
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef Mc32DmaUart_H
+#define Mc32DmaUart_H
+/*--------------------------------------------------------*/
+// Mc32DmaUart.h
+/*--------------------------------------------------------*/
+//	Description :	transferts DMA entre l'USART1 et les
+//			        fifos de communication (TP2 PWM&RS232)
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.0
+//	Compilateur	:	XC32 V2.50 + Harmony 2.06
+//
+//  Réception : le canal DMA_UART_RX_CHANNEL copie chaque octet
+//  reçu par l'USART1 directement dans le buffer du fifo de
+//  réception (auto-enable, rebouclement en fin de buffer). La
+//  boucle principale lit le pointeur d'écriture du DMA et publie
+//  l'index d'écriture du fifo avec DMAUART_RxUpdate().
+//
+//  Emission : chaque morceau contigu du fifo d'émission est confié
+//  au canal DMA_UART_TX_CHANNEL (1 cellule par place libre dans le
+//  buffer HW de l'USART). L'interruption de fin de bloc consomme le
+//  morceau et lance le suivant : une interruption par message au lieu
+//  d'une par octet. Le CTS suspend / reprend le canal.
+//
+//  Hors cible (PC), le DMA est remplacé par un producteur simulé
+//  (DMAUART_SimRxBytes) qui écrit dans le buffer et avance le
+//  pointeur exactement comme le ferait le canal DMA, et par un
+//  consommateur simulé (DMAUART_SimTxTransfert) côté émission.
+//
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+#include "GesFifoTh32.h"
+
+// Canaux DMA utilisés (le canal 2 est réservé au CRC)
+#define DMA_UART_RX_CHANNEL 0
+#define DMA_UART_TX_CHANNEL 1
+
+// Taille maximale d'un bloc DMA (DCHxDSIZ sur 8 bits)
+#define DMA_UART_BLOC_MAX 256
+
+/*--------------------------------------------------------*/
+// Définition des fonctions prototypes
+/*--------------------------------------------------------*/
+
+// Configure le canal de réception sur le buffer du fifo
+// La taille du fifo doit être <= DMA_UART_BLOC_MAX
+// Retourne 0 si OK, 1 si taille de fifo incompatible
+uint8_t DMAUART_RxInit(S_fifo *pFifo);
+
+// Lit le pointeur d'écriture du DMA et publie les octets reçus
+// dans le fifo. Retourne le nombre de nouveaux octets.
+// A appeler depuis la boucle principale (consommateur du fifo).
+uint32_t DMAUART_RxUpdate(S_fifo *pFifo);
+
+// Nombre d'octets écrasés par le DMA avant d'avoir été lus
+extern uint32_t DMAUART_RxNbrPerdus;
+
+// Configure le canal d'émission (l'interruption de fin de bloc du
+// canal doit être autorisée par l'appelant)
+void DMAUART_TxInit(void);
+
+// Appel cyclique (boucle principale) : lance l'émission du prochain
+// morceau si le canal est libre, suspend ou reprend le transfert en
+// cours selon emissionAutorisee (CTS)
+void DMAUART_TxDemarre(S_fifo *pFifo, uint8_t emissionAutorisee);
+
+// Appel depuis l'interruption de fin de bloc du canal d'émission :
+// consomme le morceau émis et lance le suivant
+void DMAUART_TxBlocTermine(S_fifo *pFifo, uint8_t emissionAutorisee);
+
+#ifndef __PIC32MX__
+// Producteur DMA simulé : dépose nbChar octets dans le buffer
+void DMAUART_SimRxBytes(const int8_t *pData, uint32_t nbChar);
+
+// Consommateur DMA simulé : termine le transfert en cours (copié dans
+// pDest) puis exécute la fin de bloc. Retourne le nombre d'octets émis.
+uint32_t DMAUART_SimTxTransfert(S_fifo *pFifo, int8_t *pDest,
+                                uint8_t emissionAutorisee);
+#endif
+
+#endif
@@ -0,0 +1,176 @@
+// Mc32Filtre.c
+// Filtrage des mesures ADC
+// CFO 17.10.2026 moyenne glissante à somme courante
+// CFO 17.10.2026 chaîne médiane / CIC / moyenne / EMA par canal
+// CFO 17.10.2026 ajout par blocs (acquisition DMA)
+
+#include "Mc32Filtre.h"
+
+
+uint8_t FILTRE_MoyInit(S_filtreMoy *pFiltre, uint16_t *pEch, uint8_t nbCanaux,
+                       uint8_t log2Fenetre, uint16_t valeurInit)
+{
+    uint32_t i;
+    uint8_t c;
+
+    // somme de 2^16 valeurs 16 bits au plus dans 32 bits
+    if ((nbCanaux == 0) || (nbCanaux > FILTRE_MOY_CANAUX_MAX) || (log2Fenetre > 15))
+    {
+        return 1;
+    }
+    pFiltre->pEch = pEch;
+    pFiltre->nbCanaux = nbCanaux;
+    pFiltre->log2Fenetre = log2Fenetre;
+    pFiltre->masque = (1u << log2Fenetre) - 1;
+    pFiltre->index = 0;
+    for (i = 0; i < ((uint32_t)nbCanaux << log2Fenetre); i++)
+    {
+        pEch[i] = valeurInit;
+    }
+    for (c = 0; c < nbCanaux; c++)
+    {
+        pFiltre->somme[c] = (uint32_t)valeurInit << log2Fenetre;
+    }
+    return 0;
+}
+
+
+void FILTRE_MoyAjoute(S_filtreMoy *pFiltre, const uint16_t *pEch)
+{
+    uint16_t *pLigne = &pFiltre->pEch[pFiltre->index * pFiltre->nbCanaux];
+    uint8_t c;
+
+    for (c = 0; c < pFiltre->nbCanaux; c++)
+    {
+        pFiltre->somme[c] += pEch[c];
+        pFiltre->somme[c] -= pLigne[c];
+        pLigne[c] = pEch[c];
+    }
+    pFiltre->index = (pFiltre->index + 1) & pFiltre->masque;
+}
+
+
+#if FILTRE_MEDIANE
+
+// Echange a, b si a > b
+#define TRI2(a, b) do { if ((a) > (b)) { uint16_t t = (a); (a) = (b); (b) = t; } } while (0)
+
+// Médiane de l'historique (réseau de comparaisons, copie locale)
+static uint16_t Mediane(const uint16_t *pMed)
+{
+    uint16_t p0 = pMed[0], p1 = pMed[1], p2 = pMed[2];
+#if FILTRE_MEDIANE == 5
+    uint16_t p3 = pMed[3], p4 = pMed[4];
+
+    TRI2(p0, p1); TRI2(p3, p4); TRI2(p0, p3);
+    TRI2(p1, p4); TRI2(p1, p2); TRI2(p2, p3);
+    TRI2(p1, p2);
+    return p2;
+#else
+    TRI2(p0, p1); TRI2(p1, p2); TRI2(p0, p1);
+    return p1;
+#endif
+}
+
+#endif
+
+
+void FILTRE_CanalInit(S_filtreCanal *pCanal, uint16_t valeurInit)
+{
+#if FILTRE_MEDIANE || FILTRE_CIC_ORDRE
+    uint8_t n;
+#endif
+
+#if FILTRE_MEDIANE
+    for (n = 0; n < FILTRE_MEDIANE; n++)
+    {
+        pCanal->med[n] = valeurInit;
+    }
+    pCanal->medIndex = 0;
+#endif
+#if FILTRE_CIC_ORDRE
+    for (n = 0; n < FILTRE_CIC_ORDRE; n++)
+    {
+        pCanal->integ[n] = 0;
+        pCanal->peigne[n] = 0;
+    }
+    pCanal->cicPhase = 0;
+#endif
+#if FILTRE_MOY_LOG2
+    FILTRE_MoyInit(&pCanal->moy, pCanal->moyEch, 1, FILTRE_MOY_LOG2, valeurInit);
+#endif
+#if FILTRE_EMA_K
+    pCanal->ema = (int32_t)valeurInit << FILTRE_EMA_FRAC;
+#endif
+    pCanal->sortie = valeurInit;
+}
+
+
+uint8_t FILTRE_CanalAjoute(S_filtreCanal *pCanal, uint16_t ech)
+{
+    uint32_t x = ech;
+#if FILTRE_MOY_LOG2
+    uint16_t valeur;
+#endif
+#if FILTRE_CIC_ORDRE
+    uint32_t precedent;
+    uint8_t n;
+#endif
+
+#if FILTRE_MEDIANE
+    pCanal->med[pCanal->medIndex] = ech;
+    pCanal->medIndex = (pCanal->medIndex + 1 < FILTRE_MEDIANE) ? pCanal->medIndex + 1 : 0;
+    x = Mediane(pCanal->med);
+#endif
+
+#if FILTRE_CIC_ORDRE
+    // intégrateurs à chaque échantillon
+    for (n = 0; n < FILTRE_CIC_ORDRE; n++)
+    {
+        pCanal->integ[n] += x;
+        x = pCanal->integ[n];
+    }
+    pCanal->cicPhase = (pCanal->cicPhase + 1) & ((1u << FILTRE_CIC_LOG2_R) - 1);
+    if (pCanal->cicPhase != 0)
+    {
+        return 0;
+    }
+    // peignes (retard 1) au rythme décimé
+    for (n = 0; n < FILTRE_CIC_ORDRE; n++)
+    {
+        precedent = pCanal->peigne[n];
+        pCanal->peigne[n] = x;
+        x -= precedent;
+    }
+    x >>= FILTRE_CIC_ORDRE * FILTRE_CIC_LOG2_R;
+#endif
+
+#if FILTRE_MOY_LOG2
+    valeur = x;
+    FILTRE_MoyAjoute(&pCanal->moy, &valeur);
+    x = FILTRE_MoyGet(&pCanal->moy, 0);
+#endif
+
+#if FILTRE_EMA_K
+    pCanal->ema += (((int32_t)x << FILTRE_EMA_FRAC) - pCanal->ema) >> FILTRE_EMA_K;
+    x = (pCanal->ema + (1 << (FILTRE_EMA_FRAC - 1))) >> FILTRE_EMA_FRAC;
+#endif
+
+    pCanal->sortie = x;
+    return 1;
+}
+
+
+uint8_t FILTRE_CanalAjouteBloc(S_filtreCanal *pCanal, const uint16_t *pEch,
+                               uint32_t nb, uint8_t pas)
+{
+    uint8_t nouvelle = 0;
+
+    while (nb > 0)
+    {
+        nouvelle |= FILTRE_CanalAjoute(pCanal, *pEch);
+        pEch += pas;
+        nb--;
+    }
+    return nouvelle;
+}
@@ -0,0 +1,154 @@
+#ifndef Mc32Filtre_H
+#define Mc32Filtre_H
+/*--------------------------------------------------------*/
+// Mc32Filtre.h
+/*--------------------------------------------------------*/
+//	Description :	filtrage des mesures ADC
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.1
+//	Compilateur	:	XC32 V2.50 + Harmony 2.06
+//
+//  Moyenne glissante à somme courante : à chaque échantillon la
+//  somme de chaque canal est mise à jour (+ nouveau, - plus
+//  ancien), la moyenne est la somme décalée de log2(fenêtre).
+//  Le coût par échantillon ne dépend pas de la taille de la
+//  fenêtre. Plusieurs canaux sont filtrés ensemble, avec un
+//  index commun ; le buffer des échantillons est fourni par
+//  l'appelant (fenêtre x canaux valeurs).
+//
+//  Chaîne de filtres d'un canal (S_filtreCanal) : étages entiers
+//  choisis à la compilation, un étage à 0 ne génère aucun code.
+//  Ordre fixe :
+//   1. médiane de 3 ou 5 : rejet des pointes isolées
+//   2. CIC d'ordre N, décimation R = 2^FILTRE_CIC_LOG2_R : une
+//      sortie tous les R échantillons, gain R^N compensé par
+//      décalage ; les étages suivants tournent au rythme décimé
+//   3. moyenne glissante sur 2^FILTRE_MOY_LOG2 valeurs
+//   4. EMA virgule fixe : y += (x - y) / 2^FILTRE_EMA_K, y avec
+//      FILTRE_EMA_FRAC bits fractionnaires
+//  Les options se fixent à la compilation (-D) pour tout le projet :
+//  Mc32Filtre.c et chaque module qui utilise S_filtreCanal doivent
+//  voir les mêmes valeurs. Voir 'make bench-filtre' dans firmware/sim
+//  pour le coût de chaque chaîne par échantillon.
+//
+//  CFO 17.10.2026 chaîne de filtres par canal
+//  CFO 17.10.2026 consommation par blocs
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+
+// Nombre maximal de canaux d'une moyenne glissante
+#define FILTRE_MOY_CANAUX_MAX 4
+
+// Descripteur d'une moyenne glissante multi-canaux
+typedef struct {
+    uint16_t *pEch;         // échantillons, [fenêtre][canaux]
+    uint32_t somme[FILTRE_MOY_CANAUX_MAX];
+    uint16_t masque;        // fenêtre - 1
+    uint16_t index;         // prochaine ligne remplacée
+    uint8_t log2Fenetre;
+    uint8_t nbCanaux;
+} S_filtreMoy;
+
+// Initialisation, toute la fenêtre à valeurInit
+// pEch : (1 << log2Fenetre) * nbCanaux valeurs
+// Retourne 0 si OK, 1 si nbCanaux ou log2Fenetre invalide
+uint8_t FILTRE_MoyInit(S_filtreMoy *pFiltre, uint16_t *pEch, uint8_t nbCanaux,
+                       uint8_t log2Fenetre, uint16_t valeurInit);
+
+// Ajoute un échantillon par canal (pEch[canal]), remplace le plus ancien
+void FILTRE_MoyAjoute(S_filtreMoy *pFiltre, const uint16_t *pEch);
+
+// Moyenne actuelle du canal (arrondie vers le bas)
+static inline uint16_t FILTRE_MoyGet(const S_filtreMoy *pFiltre, uint8_t canal)
+{
+    return pFiltre->somme[canal] >> pFiltre->log2Fenetre;
+}
+
+
+/*--------------------------------------------------------*/
+// Chaîne de filtres d'un canal
+/*--------------------------------------------------------*/
+
+// Chaîne par défaut : moyenne glissante sur 8 valeurs
+
+// Médiane : 0 (sans), 3 ou 5 échantillons
+#ifndef FILTRE_MEDIANE
+#define FILTRE_MEDIANE 0
+#endif
+
+// CIC : ordre 0 (sans) à 4, décimation 2^FILTRE_CIC_LOG2_R
+#ifndef FILTRE_CIC_ORDRE
+#define FILTRE_CIC_ORDRE 0
+#endif
+#ifndef FILTRE_CIC_LOG2_R
+#define FILTRE_CIC_LOG2_R 2
+#endif
+
+// Moyenne glissante : log2 de la fenêtre, 0 = sans
+#ifndef FILTRE_MOY_LOG2
+#define FILTRE_MOY_LOG2 3
+#endif
+
+// EMA : constante 2^FILTRE_EMA_K échantillons, 0 = sans
+#ifndef FILTRE_EMA_K
+#define FILTRE_EMA_K 0
+#endif
+#define FILTRE_EMA_FRAC 8
+
+#if (FILTRE_MEDIANE != 0) && (FILTRE_MEDIANE != 3) && (FILTRE_MEDIANE != 5)
+#error "FILTRE_MEDIANE : 0, 3 ou 5"
+#endif
+#if (FILTRE_CIC_ORDRE > 4) || (16 + FILTRE_CIC_ORDRE * FILTRE_CIC_LOG2_R > 32)
+#error "FILTRE_CIC : ordre 0..4, 16 + ordre * log2(R) <= 32 bits"
+#endif
+#if (FILTRE_EMA_K > 15) || (FILTRE_MOY_LOG2 > 15)
+#error "FILTRE_EMA_K, FILTRE_MOY_LOG2 : 0..15"
+#endif
+
+typedef struct {
+#if FILTRE_MEDIANE
+    uint16_t med[FILTRE_MEDIANE];
+    uint8_t medIndex;
+#endif
+#if FILTRE_CIC_ORDRE
+    // registres modulo 2^32 : le débordement des intégrateurs est
+    // compensé par les peignes
+    uint32_t integ[FILTRE_CIC_ORDRE];
+    uint32_t peigne[FILTRE_CIC_ORDRE];
+    uint8_t cicPhase;
+#endif
+#if FILTRE_MOY_LOG2
+    uint16_t moyEch[1 << FILTRE_MOY_LOG2];
+    S_filtreMoy moy;
+#endif
+#if FILTRE_EMA_K
+    int32_t ema;
+#endif
+    uint16_t sortie;        // dernière valeur filtrée
+} S_filtreCanal;
+
+// Initialisation de la chaîne, sortie et historiques à valeurInit
+// (le CIC démarre à 0 : transitoire de ordre * R échantillons)
+void FILTRE_CanalInit(S_filtreCanal *pCanal, uint16_t valeurInit);
+
+// Ajoute un échantillon brut
+// Retourne 1 si une nouvelle valeur filtrée est disponible, 0 sinon
+// (CIC : une sortie tous les R échantillons)
+uint8_t FILTRE_CanalAjoute(S_filtreCanal *pCanal, uint16_t ech);
+
+// Ajoute un bloc de nb échantillons bruts, pris tous les pas valeurs
+// (blocs entrelacés de plusieurs canaux)
+// Retourne 1 si au moins une nouvelle valeur filtrée est disponible
+uint8_t FILTRE_CanalAjouteBloc(S_filtreCanal *pCanal, const uint16_t *pEch,
+                               uint32_t nb, uint8_t pas);
+
+// Dernière valeur filtrée
+static inline uint16_t FILTRE_CanalValeur(const S_filtreCanal *pCanal)
+{
+    return pCanal->sortie;
+}
+
+#endif
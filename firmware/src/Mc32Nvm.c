@@ -0,0 +1,184 @@
+// Mc32Nvm.c
+// Sauvegarde de paramètres dans une page de la flash programme
+// CFO 17.10.2026 création
+
+#include <string.h>
+#include "Mc32Nvm.h"
+#include "Mc32CalCrc16.h"
+#ifdef __PIC32MX__
+#include <xc.h>
+#include <sys/kmem.h>
+#endif
+
+
+#define NVM_PAGE_MOTS (NVM_PAGE_TAILLE / 4)
+#define NVM_DONNEES_MOTS (NVM_PARAM_TAILLE_MAX / 4)
+// Index des mots de l'enregistrement
+#define NVM_MOT_MARQUE 0
+#define NVM_MOT_ENTETE 1
+#define NVM_MOT_DONNEES 2
+
+
+#ifdef __PIC32MX__
+
+// Opérations NVMOP du contrôleur de flash
+#define NVM_OP_MOT 0x1
+#define NVM_OP_PAGE 0x4
+// Démarrage du détecteur de basse tension : 6 us en ticks du core
+// timer (SYS_CLK_FREQ / 2, 40 MHz)
+#define NVM_ATTENTE_LVD 240
+
+// Page réservée, alignée sur une page de flash
+static const uint32_t nvmPage[NVM_PAGE_MOTS]
+    __attribute__((aligned(NVM_PAGE_TAILLE), space(prog))) = { 0xFFFFFFFF };
+
+// Lecture non cachée (KSEG1) : pas de ligne périmée du cache de
+// préchargement après une programmation
+static uint32_t NvmMotLit(uint32_t index)
+{
+    return *(const volatile uint32_t *)KVA0_TO_KVA1(&nvmPage[index]);
+}
+
+// Séquence de déverrouillage et exécution d'une opération, interruptions
+// bloquées. Retourne 1 si erreur (WRERR ou LVDERR)
+static uint8_t NvmOperation(uint32_t nvmop)
+{
+    uint32_t etat, t0;
+
+    etat = __builtin_disable_interrupts();
+    NVMCON = _NVMCON_WREN_MASK | nvmop;
+    t0 = _CP0_GET_COUNT();
+    while ((_CP0_GET_COUNT() - t0) < NVM_ATTENTE_LVD)
+    {
+    }
+    NVMKEY = 0xAA996655;
+    NVMKEY = 0x556699AA;
+    NVMCONSET = _NVMCON_WR_MASK;
+    while (NVMCON & _NVMCON_WR_MASK)
+    {
+    }
+    NVMCONCLR = _NVMCON_WREN_MASK;
+    __builtin_mtc0(_CP0_STATUS, _CP0_STATUS_SELECT, etat);
+    return (NVMCON & (_NVMCON_WRERR_MASK | _NVMCON_LVDERR_MASK)) ? 1 : 0;
+}
+
+static uint8_t NvmPageEfface(void)
+{
+    NVMADDR = KVA_TO_PA(nvmPage);
+    return NvmOperation(NVM_OP_PAGE);
+}
+
+static uint8_t NvmMotEcrit(uint32_t index, uint32_t mot)
+{
+    NVMADDR = KVA_TO_PA(&nvmPage[index]);
+    NVMDATA = mot;
+    return NvmOperation(NVM_OP_MOT);
+}
+
+#else
+
+// Page simulée, effacée au premier accès
+static uint32_t nvmSimPage[NVM_PAGE_MOTS];
+static uint8_t nvmSimPrete = 0;
+
+void NVM_SimEfface(void)
+{
+    memset(nvmSimPage, 0xFF, sizeof(nvmSimPage));
+    nvmSimPrete = 1;
+}
+
+uint8_t *NVM_SimPage(void)
+{
+    if (nvmSimPrete == 0)
+    {
+        NVM_SimEfface();
+    }
+    return (uint8_t *)nvmSimPage;
+}
+
+static uint32_t NvmMotLit(uint32_t index)
+{
+    return ((const uint32_t *)NVM_SimPage())[index];
+}
+
+static uint8_t NvmPageEfface(void)
+{
+    NVM_SimEfface();
+    return 0;
+}
+
+// La programmation ne peut que passer des bits à 0, comme la flash
+static uint8_t NvmMotEcrit(uint32_t index, uint32_t mot)
+{
+    ((uint32_t *)NVM_SimPage())[index] &= mot;
+    return 0;
+}
+
+#endif
+
+
+uint8_t NVM_ParamLire(void *pDonnees, uint16_t taille)
+{
+    uint32_t mots[NVM_DONNEES_MOTS];
+    uint32_t entete, i;
+
+    if ((taille == 0) || (taille > NVM_PARAM_TAILLE_MAX) ||
+        (NvmMotLit(NVM_MOT_MARQUE) != NVM_PARAM_MARQUE))
+    {
+        return 1;
+    }
+    entete = NvmMotLit(NVM_MOT_ENTETE);
+    if ((entete & 0xFFFF) != taille)
+    {
+        return 1;
+    }
+    for (i = 0; i < (taille + 3u) / 4; i++)
+    {
+        mots[i] = NvmMotLit(NVM_MOT_DONNEES + i);
+    }
+    if (crc16_ccitt((const uint8_t *)mots, taille, 0xFFFF) != (entete >> 16))
+    {
+        return 1;
+    }
+    memcpy(pDonnees, mots, taille);
+    return 0;
+}
+
+
+uint8_t NVM_ParamEcrire(const void *pDonnees, uint16_t taille)
+{
+    uint32_t mots[NVM_DONNEES_MOTS];
+    uint32_t entete, i, nbMots;
+    uint8_t erreur;
+
+    if ((taille == 0) || (taille > NVM_PARAM_TAILLE_MAX))
+    {
+        return 1;
+    }
+    memset(mots, 0xFF, sizeof(mots));
+    memcpy(mots, pDonnees, taille);
+    nbMots = (taille + 3u) / 4;
+    entete = taille | ((uint32_t)crc16_ccitt((const uint8_t *)mots, taille, 0xFFFF) << 16);
+
+    // données puis en-tête, la marque en dernier : un enregistrement
+    // incomplet n'est jamais reconnu
+    erreur = NvmPageEfface();
+    for (i = 0; (i < nbMots) && (erreur == 0); i++)
+    {
+        erreur = NvmMotEcrit(NVM_MOT_DONNEES + i, mots[i]);
+    }
+    if (erreur == 0)
+    {
+        erreur = NvmMotEcrit(NVM_MOT_ENTETE, entete);
+    }
+    if (erreur == 0)
+    {
+        erreur = NvmMotEcrit(NVM_MOT_MARQUE, NVM_PARAM_MARQUE);
+    }
+    // relecture
+    for (i = 0; (i < nbMots) && (erreur == 0); i++)
+    {
+        erreur = (NvmMotLit(NVM_MOT_DONNEES + i) != mots[i]);
+    }
+    return erreur;
+}
@@ -0,0 +1,67 @@
+#ifndef Mc32Nvm_H
+#define Mc32Nvm_H
+/*--------------------------------------------------------*/
+// Mc32Nvm.h
+/*--------------------------------------------------------*/
+//	Description :	sauvegarde de paramètres dans une page
+//			        de la flash programme (TP2 PWM&RS232)
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.0
+//	Compilateur	:	XC32 V2.50 + Harmony 2.06
+//
+//  Une page de flash (NVM_PAGE_TAILLE octets, alignée) est réservée
+//  aux paramètres. Elle contient un seul enregistrement :
+//   mot 0 : NVM_PARAM_MARQUE
+//   mot 1 : taille (16 bits faibles), CRC16 des données (16 bits forts)
+//   mots suivants : données, complétées à un multiple de 4 octets
+//  L'écriture efface la page puis programme l'enregistrement mot par
+//  mot : une coupure pendant l'écriture laisse une page effacée ou un
+//  CRC faux, l'enregistrement est alors ignoré à la lecture.
+//
+//  Pendant l'effacement (~20 ms) et la programmation, le CPU est
+//  arrêté sur la flash : les interruptions sont retardées, quelques
+//  octets reçus par l'USART peuvent être perdus. Le PWM continue
+//  (matériel). La page supporte environ 1000 effacements :
+//  l'écriture est réservée aux demandes explicites de sauvegarde.
+//  La page est effacée à chaque programmation de la carte.
+//
+//  Hors cible (PC), la page est un tableau en RAM qui garde son
+//  contenu d'une initialisation à l'autre (redémarrage simulé).
+//
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+
+// Page de la flash programme du PIC32MX795F512L
+#define NVM_PAGE_TAILLE 4096
+
+// Taille maximale des données d'un enregistrement
+#define NVM_PARAM_TAILLE_MAX 64
+
+// Marque d'un enregistrement écrit ("PAR1")
+#define NVM_PARAM_MARQUE 0x31524150
+
+/*--------------------------------------------------------*/
+// Définition des fonctions prototypes
+/*--------------------------------------------------------*/
+
+// Copie les données de l'enregistrement dans pDonnees
+// Retourne 0 si un enregistrement de cette taille est présent et
+// valide (marque, taille, CRC), 1 sinon (pDonnees inchangé)
+uint8_t NVM_ParamLire(void *pDonnees, uint16_t taille);
+
+// Efface la page et écrit l'enregistrement
+// Retourne 0 si OK, 1 si taille invalide ou erreur de programmation
+uint8_t NVM_ParamEcrire(const void *pDonnees, uint16_t taille);
+
+#ifndef __PIC32MX__
+// Efface la page simulée (carte neuve)
+void NVM_SimEfface(void);
+
+// Accès à la page simulée (corruption volontaire dans les tests)
+uint8_t *NVM_SimPage(void);
+#endif
+
+#endif
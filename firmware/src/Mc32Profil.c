@@ -0,0 +1,253 @@
+// Mc32Profil.c
+// Mesure des durées d'exécution avec le core timer MIPS
+// CFO 17.10.2026 instrumentation des interruptions
+// CFO 17.10.2026 budget de la boucle principale
+
+#include "Mc32Profil.h"
+#ifdef __PIC32MX__
+#include <xc.h>
+#else
+#include <time.h>
+#endif
+
+
+// Statistiques par vecteur d'interruption
+S_profilStat ISRP_Duree[ISRP_NB_VECT];
+S_profilStat ISRP_Latences[ISRP_NB_VECT];
+
+// Valeur du core timer à l'entrée de chaque vecteur
+static uint32_t isrpDebut[ISRP_NB_VECT];
+
+// Statistiques de la boucle principale (fenêtre publiée et en cours)
+S_profilStat CYCP_Stats[CYCP_NB_ETAPES];
+static S_profilStat cycpFenetre[CYCP_NB_ETAPES];
+static uint16_t cycpNbFenetre = 0;
+volatile uint32_t CYCP_NbrTicksManques = 0;
+uint32_t CYCP_NbrHorsBudget = 0;
+uint32_t CYCP_NbrCycles = 0;
+// Core timer au début du cycle et à la fin de l'étape précédente
+static uint32_t cycpDebut;
+static uint32_t cycpMarque;
+
+
+#ifdef __PIC32MX__
+
+uint32_t PROFIL_CompteurGet(void)
+{
+    return _CP0_GET_COUNT();
+}
+
+// Section critique courte pour une lecture cohérente
+static uint32_t ProfilBloque(void)
+{
+    return __builtin_disable_interrupts();
+}
+
+static void ProfilRestaure(uint32_t etat)
+{
+    __builtin_mtc0(_CP0_STATUS, _CP0_STATUS_SELECT, etat);
+}
+
+#else
+
+// Hors cible : ticks de 25 ns comme le core timer à 40 MHz
+uint32_t PROFIL_CompteurGet(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)(((uint64_t)t.tv_sec * 1000000000u + t.tv_nsec) / 25);
+}
+
+static uint32_t ProfilBloque(void)
+{
+    return 0;
+}
+
+static void ProfilRestaure(uint32_t etat)
+{
+    (void)etat;
+}
+
+#endif
+
+
+void PROFIL_StatInit(S_profilStat *pStat)
+{
+    uint8_t i;
+
+    pStat->nb = 0;
+    pStat->min = 0xFFFFFFFF;
+    pStat->max = 0;
+    pStat->somme = 0;
+    for (i = 0; i < PROFIL_NB_CLASSES; i++)
+    {
+        pStat->histo[i] = 0;
+    }
+}
+
+
+void PROFIL_StatAjoute(S_profilStat *pStat, uint32_t ticks)
+{
+    uint8_t classe;
+
+    pStat->nb++;
+    pStat->somme += ticks;
+    if (ticks < pStat->min)
+    {
+        pStat->min = ticks;
+    }
+    if (ticks > pStat->max)
+    {
+        pStat->max = ticks;
+    }
+
+    // classe log2 (0 et 1 tick dans la classe 0)
+    classe = (ticks > 1) ? (31 - __builtin_clz(ticks)) : 0;
+    if (classe >= PROFIL_NB_CLASSES)
+    {
+        classe = PROFIL_NB_CLASSES - 1;
+    }
+    if (pStat->histo[classe] < 0xFFFF)
+    {
+        pStat->histo[classe]++;
+    }
+}
+
+
+void PROFIL_EcritU32(uint8_t *pDest, uint32_t val)
+{
+    pDest[0] = val & 0xFF;
+    pDest[1] = (val >> 8) & 0xFF;
+    pDest[2] = (val >> 16) & 0xFF;
+    pDest[3] = (val >> 24) & 0xFF;
+}
+
+
+uint8_t PROFIL_StatExporte(const S_profilStat *pStat, E_profilPage page,
+                           uint8_t *pDest)
+{
+    S_profilStat copie;
+    uint32_t etat;
+    uint8_t i;
+
+    etat = ProfilBloque();
+    copie = *pStat;
+    ProfilRestaure(etat);
+
+    if (page == PROFIL_PAGE_HISTO)
+    {
+        for (i = 0; i < PROFIL_NB_CLASSES; i++)
+        {
+            pDest[2 * i] = copie.histo[i] & 0xFF;
+            pDest[2 * i + 1] = copie.histo[i] >> 8;
+        }
+        return PROFIL_TAILLE_HISTO;
+    }
+
+    PROFIL_EcritU32(&pDest[0], copie.nb);
+    PROFIL_EcritU32(&pDest[4], (copie.nb > 0) ? copie.min : 0);
+    PROFIL_EcritU32(&pDest[8], copie.max);
+    PROFIL_EcritU32(&pDest[12], (copie.nb > 0) ? (uint32_t)(copie.somme / copie.nb) : 0);
+    return PROFIL_TAILLE_STATS;
+}
+
+
+void ISRP_Init(void)
+{
+    uint8_t v;
+    uint32_t etat;
+
+    etat = ProfilBloque();
+    for (v = 0; v < ISRP_NB_VECT; v++)
+    {
+        PROFIL_StatInit(&ISRP_Duree[v]);
+        PROFIL_StatInit(&ISRP_Latences[v]);
+    }
+    ProfilRestaure(etat);
+}
+
+
+void ISRP_Entree(E_isrpVect vect)
+{
+    isrpDebut[vect] = PROFIL_CompteurGet();
+}
+
+
+void ISRP_Sortie(E_isrpVect vect)
+{
+    PROFIL_StatAjoute(&ISRP_Duree[vect], PROFIL_CompteurGet() - isrpDebut[vect]);
+}
+
+
+void ISRP_Latence(E_isrpVect vect, uint32_t ticks)
+{
+    PROFIL_StatAjoute(&ISRP_Latences[vect], ticks);
+}
+
+
+void CYCP_Init(void)
+{
+    uint8_t e;
+
+    for (e = 0; e < CYCP_NB_ETAPES; e++)
+    {
+        PROFIL_StatInit(&CYCP_Stats[e]);
+        PROFIL_StatInit(&cycpFenetre[e]);
+    }
+    cycpNbFenetre = 0;
+    CYCP_NbrTicksManques = 0;
+    CYCP_NbrHorsBudget = 0;
+    CYCP_NbrCycles = 0;
+}
+
+
+void CYCP_Debut(void)
+{
+    cycpDebut = PROFIL_CompteurGet();
+    cycpMarque = cycpDebut;
+}
+
+
+void CYCP_Etape(E_cycpEtape etape)
+{
+    uint32_t maintenant = PROFIL_CompteurGet();
+
+    PROFIL_StatAjoute(&cycpFenetre[etape], maintenant - cycpMarque);
+    cycpMarque = maintenant;
+}
+
+
+void CYCP_Fin(void)
+{
+    uint32_t total = PROFIL_CompteurGet() - cycpDebut;
+    uint8_t e;
+
+    PROFIL_StatAjoute(&cycpFenetre[CYCP_TOTAL], total);
+    if (total > CYCP_BUDGET_TICKS)
+    {
+        CYCP_NbrHorsBudget++;
+    }
+    CYCP_NbrCycles++;
+
+    // fenêtre complète : publication et nouvelle fenêtre
+    cycpNbFenetre++;
+    if (cycpNbFenetre >= CYCP_FENETRE)
+    {
+        for (e = 0; e < CYCP_NB_ETAPES; e++)
+        {
+            CYCP_Stats[e] = cycpFenetre[e];
+            PROFIL_StatInit(&cycpFenetre[e]);
+        }
+        cycpNbFenetre = 0;
+    }
+}
+
+
+void CYCP_Tick(uint8_t serviceEnCours)
+{
+    if (serviceEnCours)
+    {
+        CYCP_NbrTicksManques++;
+    }
+}
@@ -0,0 +1,159 @@
+#ifndef Mc32Profil_H
+#define Mc32Profil_H
+/*--------------------------------------------------------*/
+// Mc32Profil.h
+/*--------------------------------------------------------*/
+//	Description :	mesure des durées d'exécution avec le
+//			        core timer MIPS (TP2 PWM&RS232)
+//
+//	Auteur 		: 	CFO
+//
+//	Version		:	V1.0
+//	Compilateur	:	XC32 V2.50 + Harmony 2.06
+//
+//  Le core timer compte à SYS_CLK_FREQ / 2 (40 MHz, 25 ns).
+//  Chaque statistique garde nb, min, max, somme (moyenne) et un
+//  histogramme log2 : la classe k compte les mesures de
+//  2^k à 2^(k+1)-1 ticks, la dernière classe est saturée.
+//
+//  Interruptions : ISRP_ENTREE / ISRP_SORTIE encadrent le corps
+//  de chaque vecteur (durée). La latence n'est mesurée que pour
+//  le timer 1, dont le compteur donne le temps écoulé depuis
+//  l'événement. La durée d'un vecteur inclut les interruptions
+//  de priorité supérieure qui l'ont préempté.
+//
+//  Boucle principale : CYCP_Debut / CYCP_Etape / CYCP_Fin mesurent
+//  chaque étape de la tâche de service et son total. Les
+//  statistiques sont accumulées sur CYCP_FENETRE cycles puis
+//  publiées (fenêtre glissante par blocs). Un dépassement est compté
+//  quand le tick suivant du timer 1 arrive avant la fin du cycle.
+//
+//  Les valeurs sont lues sur la liaison série par une commande
+//  de diagnostic (voir Mc32gest_RS232.h).
+//
+/*--------------------------------------------------------*/
+
+#include <stdint.h>
+
+// 1 : instrumentation des interruptions active
+// 0 : ISRP_ENTREE / ISRP_SORTIE ne génèrent aucun code
+#ifndef ISR_PROFIL
+#define ISR_PROFIL 1
+#endif
+
+// Nombre de cycles de 20 ms par fenêtre de statistiques (5 s)
+#define CYCP_FENETRE 250
+
+// Budget d'un cycle en ticks du core timer (20 ms à 40 MHz)
+#define CYCP_BUDGET_TICKS 800000u
+
+// Nombre de classes de l'histogramme log2
+#define PROFIL_NB_CLASSES 16
+
+// Taille des pages exportées
+#define PROFIL_TAILLE_STATS 16                      // nb, min, max, moy
+#define PROFIL_TAILLE_HISTO (2 * PROFIL_NB_CLASSES)  // classes sur 16 bits
+
+// Pages d'une statistique (commande de diagnostic)
+typedef enum
+{
+    PROFIL_PAGE_STATS = 0,
+    PROFIL_PAGE_HISTO,
+} E_profilPage;
+
+// Statistique d'une mesure en ticks du core timer
+typedef struct
+{
+    uint32_t nb;
+    uint32_t min;
+    uint32_t max;
+    uint64_t somme;
+    uint16_t histo[PROFIL_NB_CLASSES];
+} S_profilStat;
+
+// Vecteurs d'interruption instrumentés
+typedef enum
+{
+    ISRP_TMR1 = 0,
+    ISRP_USART1,
+    ISRP_DMA_TX,
+    ISRP_DMA_ADC,
+    ISRP_NB_VECT,
+} E_isrpVect;
+
+// Etapes de la tâche de service (APP_STATE_SERVICE_TASKS)
+typedef enum
+{
+    CYCP_GET_MESSAGE = 0,
+    CYCP_GET_SETTINGS,
+    CYCP_DISP_SETTINGS,
+    CYCP_EXEC_PWM,
+    CYCP_SEND_MESSAGE,
+    CYCP_TOTAL,
+    CYCP_NB_ETAPES,
+} E_cycpEtape;
+
+/*--------------------------------------------------------*/
+// Définition des fonctions prototypes
+/*--------------------------------------------------------*/
+
+// Lecture du core timer
+uint32_t PROFIL_CompteurGet(void);
+
+// Remise à zéro d'une statistique
+void PROFIL_StatInit(S_profilStat *pStat);
+
+// Ajoute une mesure (ticks) à une statistique
+void PROFIL_StatAjoute(S_profilStat *pStat, uint32_t ticks);
+
+// Copie une page d'une statistique dans pDest (little endian),
+// lecture cohérente même si la statistique est mise à jour en
+// interruption. Retourne le nombre d'octets écrits.
+uint8_t PROFIL_StatExporte(const S_profilStat *pStat, E_profilPage page,
+                           uint8_t *pDest);
+
+// Ecrit une valeur 32 bits en little endian (réponses de diagnostic)
+void PROFIL_EcritU32(uint8_t *pDest, uint32_t val);
+
+// Interruptions : début et fin du corps d'un vecteur
+void ISRP_Entree(E_isrpVect vect);
+void ISRP_Sortie(E_isrpVect vect);
+
+// Latence d'un vecteur (ticks entre événement et entrée)
+void ISRP_Latence(E_isrpVect vect, uint32_t ticks);
+
+// Remise à zéro des statistiques d'interruption
+void ISRP_Init(void);
+
+// Statistiques d'un vecteur
+extern S_profilStat ISRP_Duree[ISRP_NB_VECT];
+extern S_profilStat ISRP_Latences[ISRP_NB_VECT];
+
+// Boucle principale : début du cycle, fin d'une étape, fin du cycle
+void CYCP_Debut(void);
+void CYCP_Etape(E_cycpEtape etape);
+void CYCP_Fin(void);
+
+// Appel à chaque tick du timer 1 : détection de dépassement
+// (serviceEnCours = 1 si le cycle précédent n'est pas terminé)
+void CYCP_Tick(uint8_t serviceEnCours);
+
+// Remise à zéro des statistiques de la boucle principale
+void CYCP_Init(void);
+
+// Statistiques de la dernière fenêtre complète, par étape
+extern S_profilStat CYCP_Stats[CYCP_NB_ETAPES];
+// Dépassements : tick manqué, cycle plus long que le budget
+extern volatile uint32_t CYCP_NbrTicksManques;
+extern uint32_t CYCP_NbrHorsBudget;
+extern uint32_t CYCP_NbrCycles;
+
+#if ISR_PROFIL
+#define ISRP_ENTREE(v) ISRP_Entree(v)
+#define ISRP_SORTIE(v) ISRP_Sortie(v)
+#else
+#define ISRP_ENTREE(v)
+#define ISRP_SORTIE(v)
+#endif
+
+#endif
@@ -4,6 +4,16 @@
 // CHR 20.12.2016 ajout traitement int error
 // CHR 22.12.2016 evolution des marquers observation int Usart
 // SCA 03.01.2018 nettoyé réponse interrupt pour ne laisser que les 3 ifs
+// CFO 17.10.2026 consignes hors plage rejetées, CRC reçu recomposé sans
+//                union (indépendant de l'ordre des octets), état de
+//                réception remis à zéro par InitFifoComm, RS232_EtatCoherent
+// CFO 17.10.2026 trame v2 (version, type, séquence, longueur), trame
+//                5 octets toujours acceptée
+// CFO 17.10.2026 option de tramage COBS (RS232_COBS)
+// CFO 17.10.2026 négociation du débit (trames v2)
+// CFO 17.10.2026 calibration du servo (trame v2 CALIB_SERVO)
+// CFO 17.10.2026 sauvegarde de la calibration sur demande (CALIB_SAUVE)
+// CFO 17.10.2026 CRC reçu vérifié par CRC16_Compute, option CRC16_BACKEND_DMA
 
 #include <xc.h>
 #include <sys/attribs.h>
@@ -15,22 +25,26 @@
 #include "Mc32gest_RS232.h"
 #include "gestPWM.h"
 #include "Mc32CalCrc16.h"
+#include "Mc32DmaUart.h"
+#include "Mc32Profil.h"
+#include "Mc32Cobs.h"
+#include "Mc32ConvPwm.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 
 
-typedef union {
-        uint16_t val;
-        struct {uint8_t lsb;
-                uint8_t msb;} shl;
-} U_manip16;
-
-
 // Definition pour les messages
 #define MESS_SIZE  5
 // avec int8_t besoin -86 au lieu de 0xAA
 #define STX_code  (-86)
+// début des réponses de diagnostic (0xA5)
+#define STX_DIAG_code  (-91)
+// début des trames v2 (0xAB)
+#define STX_V2_code  (-85)
+// plus longue trame émise (réponse de diagnostic)
+#define TRAME_TAILLE_MAX  (DIAG_TAILLE_MAX + 5)
 
 
 // Structure décrivant le message
@@ -45,13 +59,40 @@ typedef struct {
 
 // Struct pour émission des messages
 StruMess TxMess;
-// Struct pour réception des messages
-StruMess RxMess;
 
 
 // Declaration des FIFO pour réception et émission
-#define FIFO_RX_SIZE ( (4*MESS_SIZE) + 1)  // 4 messages
-#define FIFO_TX_SIZE ( (4*MESS_SIZE) + 1)  // 4 messages
+// (taille puissance de 2 imposée par le ring SPSC, tailles modifiables
+// à la compilation pour les mesures sur la simulation PC)
+#ifndef FIFO_RX_SIZE
+#if RS232_RX_DMA
+// Le fifo n'est mis à jour qu'une fois par cycle de 20 ms : il doit
+// absorber un cycle complet à 57600 bauds (~115 octets)
+#define FIFO_RX_SIZE DMA_UART_BLOC_MAX
+#else
+#define FIFO_RX_SIZE 32  // 4 messages + marge
+#endif
+#endif
+#ifndef FIFO_TX_SIZE
+#define FIFO_TX_SIZE 64  // 1 réponse de diagnostic + 4 messages + marge
+#endif
+#if (FIFO_RX_SIZE <= 0) || ((FIFO_RX_SIZE & (FIFO_RX_SIZE - 1)) != 0)
+#error "FIFO_RX_SIZE doit être une puissance de 2"
+#endif
+#if (FIFO_TX_SIZE <= 0) || ((FIFO_TX_SIZE & (FIFO_TX_SIZE - 1)) != 0)
+#error "FIFO_TX_SIZE doit être une puissance de 2"
+#endif
+
+// Mode d'interruption RX du fifo HW de l'USART1
+#if RS232_RX_SEUIL_FIFO_HW == 1
+#define RX_MODE_FIFO_HW USART_RECEIVE_FIFO_ONE_CHAR
+#elif RS232_RX_SEUIL_FIFO_HW == 4
+#define RX_MODE_FIFO_HW USART_RECEIVE_FIFO_HALF_FULL
+#elif RS232_RX_SEUIL_FIFO_HW == 6
+#define RX_MODE_FIFO_HW USART_RECEIVE_FIFO_3B4FULL
+#else
+#error "RS232_RX_SEUIL_FIFO_HW doit valoir 1, 4 ou 6"
+#endif
 
 int8_t fifoRX[FIFO_RX_SIZE];
 // Declaration du descripteur du FIFO de réception
@@ -63,13 +104,746 @@ int8_t fifoTX[FIFO_TX_SIZE];
 S_fifo descrFifoTX;
 
 
+// Autorise l'émission du fifo TX si CTS = 0 (ou lance le DMA)
+static void LanceEmission(void)
+{
+#if RS232_TX_DMA
+    // lance le DMA si libre, suspend / reprend selon CTS
+    DMAUART_TxDemarre(&descrFifoTX, RS232_CTS == 0);
+#else
+    // si on a un caractère à envoyer et que CTS = 0
+    if ((RS232_CTS == 0) && (GetReadSize(&descrFifoTX) > 0))
+    {        
+        // Autorise int émission    
+        PLIB_INT_SourceEnable(INT_ID_0, INT_SOURCE_USART_1_TRANSMIT);                
+    }
+#endif
+}
+
+
+// Dépose une trame complète dans le fifo d'émission, encodée COBS et
+// suivie du délimiteur si RS232_COBS (tout ou rien comme PutBlockInFifo)
+// Retourne 0 si OK, 1 si place insuffisante
+static uint8_t EnvoieTrame(const int8_t *pTrame, uint8_t taille)
+{
+#if RS232_COBS
+    int8_t ligne[COBS_TAILLE_ENCODEE(TRAME_TAILLE_MAX) + 1];
+    uint32_t nb = COBS_Encode(pTrame, taille, ligne);
+
+    ligne[nb++] = COBS_DELIMITEUR;
+    return PutBlockInFifo(&descrFifoTX, ligne, nb);
+#else
+    return PutBlockInFifo(&descrFifoTX, pTrame, taille);
+#endif
+}
+
+
+/******************************************************************************
+    Fonction :
+    static void TraiteDiag(uint8_t id)
+
+    Résumé :
+    Répond à une commande de diagnostic.
+
+    Description :
+    Les données demandées sont copiées dans une réponse de diagnostic
+    (voir Mc32gest_RS232.h) déposée en entier dans le fifo d'émission.
+    Un id inconnu est répondu avec une longueur nulle. Si le fifo n'a pas
+    la place, la réponse est abandonnée.
+******************************************************************************/
+static void TraiteDiag(uint8_t id)
+{
+    int8_t rep[3 + DIAG_TAILLE_MAX + 2];
+    uint8_t *pDonnees = (uint8_t *)&rep[3];
+    uint8_t longueur = 0;
+    uint8_t vect, page;
+    uint16_t crc;
+
+    if ((id >= DIAG_ID_ISR) && (id < DIAG_ID_ISR + 4 * ISRP_NB_VECT))
+    {
+        vect = (id - DIAG_ID_ISR) >> 2;
+        page = (id - DIAG_ID_ISR) & 3;
+        if (page == 0)
+        {
+            longueur = PROFIL_StatExporte(&ISRP_Duree[vect], PROFIL_PAGE_STATS, pDonnees);
+        }
+        else if (page == 1)
+        {
+            longueur = PROFIL_StatExporte(&ISRP_Duree[vect], PROFIL_PAGE_HISTO, pDonnees);
+        }
+        else if (page == 2)
+        {
+            longueur = PROFIL_StatExporte(&ISRP_Latences[vect], PROFIL_PAGE_STATS, pDonnees);
+        }
+        else
+        {
+            ISRP_Init();
+        }
+    }
+    else if ((id >= DIAG_ID_CYCLE) && (id < DIAG_ID_CYCLE + 2 * CYCP_NB_ETAPES))
+    {
+        longueur = PROFIL_StatExporte(&CYCP_Stats[(id - DIAG_ID_CYCLE) >> 1],
+                                      (E_profilPage)((id - DIAG_ID_CYCLE) & 1),
+                                      pDonnees);
+    }
+    else if (id == DIAG_ID_DEPASSEMENTS)
+    {
+        PROFIL_EcritU32(&pDonnees[0], CYCP_NbrTicksManques);
+        PROFIL_EcritU32(&pDonnees[4], CYCP_NbrHorsBudget);
+        PROFIL_EcritU32(&pDonnees[8], CYCP_NbrCycles);
+        longueur = 12;
+    }
+    else if (id == DIAG_ID_CYCLE_RAZ)
+    {
+        CYCP_Init();
+    }
+    else if (id == DIAG_ID_COMM)
+    {
+        PROFIL_EcritU32(&pDonnees[0], NbrErreursCrc);
+        PROFIL_EcritU32(&pDonnees[4], NbrMessRemplaces);
+        PROFIL_EcritU32(&pDonnees[8], NbrMessHorsPlage);
+        PROFIL_EcritU32(&pDonnees[12], NbrErreursFormat);
+        PROFIL_EcritU32(&pDonnees[16], NbrTramesPerdues);
+        PROFIL_EcritU32(&pDonnees[20], NbrTramesDupliquees);
+        PROFIL_EcritU32(&pDonnees[24], RS232_Debit);
+        PROFIL_EcritU32(&pDonnees[28], NbrDebitsEchoues);
+        longueur = 32;
+    }
+
+    rep[0] = STX_DIAG_code;
+    rep[1] = id;
+    rep[2] = longueur;
+    crc = CRC16_Compute((const uint8_t *)rep, 3 + longueur, 0xFFFF);
+    rep[3 + longueur] = crc >> 8;
+    rep[4 + longueur] = crc & 0xFF;
+    if (EnvoieTrame(rep, 5 + longueur) == 0)
+    {
+        LanceEmission();
+    }
+}
+
+
+// Etats du décodeur de réception
+typedef enum {
+    RX_RECH_STX = 0,    // recherche du caractère de début (0xAA ou 0xAB)
+    RX_COLLECTE,        // collecte du message et du CRC
+} E_RxEtat;
+
+// Contexte du décodeur, conservé d'un appel à l'autre
+typedef struct {
+    E_RxEtat etat;
+    uint8_t nbRecus;    // octets du message déjà examinés (STX compris)
+    uint8_t taille;     // taille attendue du message (CRC compris)
+    int8_t octets[V2_TAILLE_MAX];   // message en cours de collecte
+    S_cobsDecodeur cobs;            // décodage COBS (RS232_COBS)
+} S_rxDecodeur;
+
+S_rxDecodeur rxDecodeur = { RX_RECH_STX, 0, MESS_SIZE };
+
+// Nombre de messages rejetés sur erreur de CRC
+uint32_t NbrErreursCrc = 0;
+// Nombre de messages valides non appliqués car suivis d'un plus récent
+uint32_t NbrMessRemplaces = 0;
+// Nombre de messages valides rejetés car consigne hors plage
+uint32_t NbrMessHorsPlage = 0;
+// Trames v2 rejetées sur la version ou la longueur
+uint32_t NbrErreursFormat = 0;
+// Trames v2 manquantes ou répétées d'après le numéro de séquence
+uint32_t NbrTramesPerdues = 0;
+uint32_t NbrTramesDupliquees = 0;
+
+// Cycles sans message et mode de fonctionnement (0 local, 1 remote)
+static uint8_t NbrCycle = 0;
+static uint8_t CommStatus = 0;
+
+// Protocole v2 : activé à la réception d'une trame v2, abandonné au
+// retour en local. Séquences reçue (si valide) et émise.
+static uint8_t ModeV2 = 0;
+static uint8_t SeqRxValide = 0;
+static uint8_t SeqRx = 0;
+static uint8_t SeqTx = 0;
+
+
+// Dépose une trame v2 (type, données) dans le fifo d'émission, numérotée
+// par SeqTx. Retourne 0 si OK, 1 si place insuffisante.
+static uint8_t EnvoieTrameV2(uint8_t type, const int8_t *pDonnees, uint8_t longueur)
+{
+    int8_t trame[V2_TAILLE_MAX];
+    uint16_t crc;
+
+    trame[0] = STX_V2_code;
+    trame[1] = V2_VERSION;
+    trame[2] = type;
+    trame[3] = SeqTx;
+    trame[4] = longueur;
+    memcpy(&trame[V2_TAILLE_ENTETE], pDonnees, longueur);
+    crc = CRC16_Compute((const uint8_t *)trame, V2_TAILLE_ENTETE + longueur, 0xFFFF);
+    trame[V2_TAILLE_ENTETE + longueur] = crc >> 8;
+    trame[V2_TAILLE_ENTETE + longueur + 1] = crc & 0xFF;
+    if (EnvoieTrame(trame, V2_TAILLE_ENTETE + longueur + 2) != 0)
+    {
+        return 1;
+    }
+    SeqTx++;
+    return 0;
+}
+
+
+/*--------------------------------------------------------*/
+// Négociation du débit (voir Mc32gest_RS232.h)
+/*--------------------------------------------------------*/
+
+// Débits normalisés, bit i du masque d'offre = DebitsStd[i]
+static const uint32_t DebitsStd[RS232_NB_DEBITS] = {
+    RS232_DEBIT_DEFAUT, 115200, 230400, 460800, 921600, 1000000
+};
+// Contenu de la sonde de vérification
+static const int8_t SondeDebit[RS232_TAILLE_SONDE] = {
+    0x55, (int8_t)0xAA, 0x00, (int8_t)0xFF, 0x0F, (int8_t)0xF0, 0x33, (int8_t)0xCC
+};
+
+typedef enum {
+    DEBIT_REPOS = 0,            // débit en cours confirmé (ou par défaut)
+    DEBIT_ATTENTE_EMISSION,     // acceptation en cours d'émission
+    DEBIT_ATTENTE_SONDE,        // nouveau débit, sonde attendue
+} E_debitEtat;
+
+static E_debitEtat DebitEtat = DEBIT_REPOS;
+static uint8_t DebitMasque = 1;     // débits réalisables par la carte
+static uint8_t DebitCycles = 0;     // cycles d'attente de la sonde
+static uint8_t DebitSilence = 0;    // cycles sans trame valide
+static uint32_t DebitChoisi = RS232_DEBIT_DEFAUT;
+
+// Débit de la ligne et négociations abandonnées (sonde absente)
+uint32_t RS232_Debit = RS232_DEBIT_DEFAUT;
+uint32_t NbrDebitsEchoues = 0;
+
+
+// Débits réalisables à RS232_DEBIT_ERREUR_MAX pour mille près, avec le
+// générateur en mode BRGH comme DRV_USART0_BaudSet :
+// débit réel = PBCLK / (4 * (BRG + 1)), BRG + 1 = PBCLK / (4 * débit)
+static uint8_t DebitMasqueCarte(void)
+{
+    uint8_t i;
+    uint8_t masque = 0;
+    uint32_t diviseur, reel, ecart;
+
+    for (i = 0; i < RS232_NB_DEBITS; i++)
+    {
+        diviseur = SYS_CLK_BUS_PERIPHERAL_1 / (4 * DebitsStd[i]);
+        if ((DebitsStd[i] > RS232_DEBIT_MAX) || (diviseur == 0))
+        {
+            continue;
+        }
+        reel = SYS_CLK_BUS_PERIPHERAL_1 / (4 * diviseur);
+        ecart = (reel > DebitsStd[i]) ? reel - DebitsStd[i] : DebitsStd[i] - reel;
+        if ((ecart * 1000) <= (RS232_DEBIT_ERREUR_MAX * DebitsStd[i]))
+        {
+            masque |= 1 << i;
+        }
+    }
+    // le débit par défaut reste toujours disponible
+    return masque | 1;
+}
+
+
+static void ChangeDebit(uint32_t debit)
+{
+    if (debit != RS232_Debit)
+    {
+        DRV_USART0_BaudSet(debit);
+        RS232_Debit = debit;
+    }
+}
+
+
+// Offre du partenaire : le plus haut débit commun est accepté, le
+// changement a lieu une fois l'acceptation émise (GereDebit)
+static void TraiteOffreDebit(uint8_t masquePartenaire)
+{
+    int8_t rep[5];
+    uint8_t communs = masquePartenaire & DebitMasque;
+    uint8_t i = RS232_NB_DEBITS - 1;
+
+    while ((i > 0) && ((communs & (1 << i)) == 0))
+    {
+        i--;
+    }
+    rep[0] = i;
+    PROFIL_EcritU32((uint8_t *)&rep[1], DebitsStd[i]);
+    if (EnvoieTrameV2(V2_TYPE_DEBIT_ACCEPTE, rep, sizeof(rep)) == 0)
+    {
+        DebitChoisi = DebitsStd[i];
+        DebitEtat = DEBIT_ATTENTE_EMISSION;
+        LanceEmission();
+    }
+}
+
+
+// Sonde reçue au nouveau débit : renvoyée telle quelle, débit confirmé
+static void TraiteSondeDebit(const int8_t *pDonnees)
+{
+    if ((DebitEtat == DEBIT_ATTENTE_SONDE) &&
+        (memcmp(pDonnees, SondeDebit, RS232_TAILLE_SONDE) == 0))
+    {
+        EnvoieTrameV2(V2_TYPE_DEBIT_SONDE, SondeDebit, RS232_TAILLE_SONDE);
+        LanceEmission();
+        DebitEtat = DEBIT_REPOS;
+    }
+}
+
+
+/******************************************************************************
+    Fonction :
+    static void GereDebit(void)
+
+    Résumé :
+    Avance la négociation du débit, appel à chaque cycle.
+
+    Description :
+    Après l'acceptation, le débit n'est changé que lorsque le fifo
+    d'émission et le registre à décalage de l'USART sont vides (la réponse
+    part entièrement à l'ancien débit). La sonde doit ensuite arriver dans
+    les RS232_SONDE_CYCLES cycles, sinon retour au débit par défaut. Hors
+    débit par défaut, la liaison est aussi abandonnée après CYCLE_MAX + 1
+    cycles sans trame valide (consigne ou non).
+******************************************************************************/
+static void GereDebit(void)
+{
+    if (DebitEtat == DEBIT_ATTENTE_EMISSION)
+    {
+        if ((GetReadSize(&descrFifoTX) == 0) &&
+            PLIB_USART_TransmitterIsEmpty(USART_ID_1))
+        {
+            ChangeDebit(DebitChoisi);
+            DebitCycles = 0;
+            DebitSilence = 0;
+            DebitEtat = DEBIT_ATTENTE_SONDE;
+        }
+    }
+    else if (DebitEtat == DEBIT_ATTENTE_SONDE)
+    {
+        DebitCycles++;
+        if (DebitCycles > RS232_SONDE_CYCLES)
+        {
+            ChangeDebit(RS232_DEBIT_DEFAUT);
+            NbrDebitsEchoues++;
+            DebitEtat = DEBIT_REPOS;
+        }
+    }
+    else if (RS232_Debit != RS232_DEBIT_DEFAUT)
+    {
+        if (DebitSilence < CYCLE_MAX)
+        {
+            DebitSilence++;
+        }
+        else
+        {
+            ChangeDebit(RS232_DEBIT_DEFAUT);
+        }
+    }
+}
+
+
+#if RS232_COBS == 0
+// Abandon du STX du message en cours, nouvelle recherche à partir de
+// l'octet suivant
+static void AbandonneStx(void)
+{
+    CommitReadFifo(&descrFifoRX, 1);
+    rxDecodeur.etat = RX_RECH_STX;
+}
+#endif
+
+
+#if RS232_COBS
+/******************************************************************************
+    Fonction :
+    static int DecodeMessage(void)
+
+    Résumé :
+    Décodeur COBS du FIFO de réception.
+
+    Description :
+    Les morceaux contigus du FIFO (PeekFifo) sont parcourus une seule fois :
+    chaque octet est décodé puis consommé, une trame incomplète reste dans
+    le décodeur COBS jusqu'au prochain appel. Au délimiteur, la trame décodée
+    est contrôlée (STX, taille, version et longueur v2, CRC) ; une trame
+    invalide est abandonnée et la resynchronisation est acquise au
+    délimiteur suivant.
+
+    Retour :
+    1 si un message valide est disponible dans rxDecodeur.octets
+    (rxDecodeur.taille octets, jusqu'à l'appel suivant), 0 sinon.
+******************************************************************************/
+static int DecodeMessage(void)
+{
+    S_fifoSpan spans[2];
+    uint32_t s, i;
+    uint32_t nbLus = 0;
+    uint8_t taille;
+    uint16_t crcRecu;
+    int8_t stx;
+
+    PeekFifo(&descrFifoRX, spans);
+    for (s = 0; s < 2; s++)
+    {
+        for (i = 0; i < spans[s].nbChar; i++)
+        {
+            nbLus++;
+            switch (COBS_DecodeOctet(&rxDecodeur.cobs, spans[s].pData[i]))
+            {
+                case COBS_EN_COURS:
+                    continue;
+                case COBS_ERREUR:
+                    NbrErreursFormat++;
+                    continue;
+                default:
+                    break;
+            }
+            taille = rxDecodeur.cobs.nb;
+            stx = rxDecodeur.octets[0];
+            if ((taille < MESS_SIZE) ||
+                ((stx == STX_code) && (taille != MESS_SIZE)) ||
+                ((stx == STX_V2_code) && ((taille < V2_TAILLE_ENTETE + 2) ||
+                                          ((uint8_t)rxDecodeur.octets[1] != V2_VERSION) ||
+                                          ((uint8_t)rxDecodeur.octets[4] != taille - V2_TAILLE_ENTETE - 2))) ||
+                ((stx != STX_code) && (stx != STX_V2_code)))
+            {
+                NbrErreursFormat++;
+                continue;
+            }
+            crcRecu = ((uint16_t)(uint8_t)rxDecodeur.octets[taille - 2] << 8) |
+                      (uint8_t)rxDecodeur.octets[taille - 1];
+            if (CRC16_Compute((const uint8_t *)rxDecodeur.octets, taille - 2, 0xFFFF) != crcRecu)
+            {
+                NbrErreursCrc++;
+                BSP_LEDToggle(BSP_LED_6);
+                continue;
+            }
+            rxDecodeur.taille = taille;
+            CommitReadFifo(&descrFifoRX, nbLus);
+            return 1;
+        }
+    }
+    CommitReadFifo(&descrFifoRX, nbLus);
+    return 0;
+}
+#else
+/******************************************************************************
+    Fonction :
+    static int DecodeMessage(void)
+
+    Résumé :
+    Décodeur octet par octet du FIFO de réception.
+
+    Description :
+    Les octets sont examinés sans être consommés (PeekCharInFifo). En
+    recherche de STX, tout octet différent de 0xAA (message 5 octets) et de
+    0xAB (trame v2) est abandonné. Une fois le STX trouvé, les octets suivants
+    sont collectés, le CRC est calculé sur le message complet par le backend
+    sélectionné (CRC16_Compute) ; la taille d'une trame v2 est connue à la réception de son octet de longueur, une version
+    ou une longueur invalide abandonne le STX sans attendre la fin. Un
+    message incomplet reste dans le FIFO et la collecte reprend au prochain
+    appel. Un message valide est consommé en entier ; sur erreur de CRC seul
+    le STX est abandonné et la recherche reprend à l'octet suivant, sans
+    attendre le cycle suivant.
+
+    Retour :
+    1 si un message valide est disponible dans rxDecodeur.octets
+    (rxDecodeur.taille octets, jusqu'à l'appel suivant), 0 sinon.
+******************************************************************************/
+static int DecodeMessage(void)
+{
+    int8_t c;
+    uint16_t crcRecu;
+
+    while (1)
+    {
+        if (rxDecodeur.etat == RX_RECH_STX)
+        {
+            if (PeekCharInFifo(&descrFifoRX, 0, &c) != 0)
+            {
+                return 0;   // FIFO vide
+            }
+            if ((c == STX_code) || (c == STX_V2_code))
+            {
+                rxDecodeur.octets[0] = c;
+                rxDecodeur.nbRecus = 1;
+                // trame v2 : taille sans données jusqu'à l'octet de longueur
+                rxDecodeur.taille = (c == STX_code) ? MESS_SIZE : V2_TAILLE_ENTETE + 2;
+                rxDecodeur.etat = RX_COLLECTE;
+            }
+            else
+            {
+                CommitReadFifo(&descrFifoRX, 1);
+            }
+        }
+        else
+        {
+            if (PeekCharInFifo(&descrFifoRX, rxDecodeur.nbRecus, &c) != 0)
+            {
+                return 0;   // message incomplet, repris au prochain appel
+            }
+            rxDecodeur.octets[rxDecodeur.nbRecus] = c;
+            rxDecodeur.nbRecus++;
+            if (rxDecodeur.octets[0] == STX_V2_code)
+            {
+                if (((rxDecodeur.nbRecus == 2) && ((uint8_t)c != V2_VERSION)) ||
+                    ((rxDecodeur.nbRecus == V2_TAILLE_ENTETE) && ((uint8_t)c > V2_DONNEES_MAX)))
+                {
+                    AbandonneStx();
+                    NbrErreursFormat++;
+                    continue;
+                }
+                if (rxDecodeur.nbRecus == V2_TAILLE_ENTETE)
+                {
+                    rxDecodeur.taille = V2_TAILLE_ENTETE + (uint8_t)c + 2;
+                }
+            }
+            if (rxDecodeur.nbRecus == rxDecodeur.taille)
+            {
+                crcRecu = ((uint16_t)(uint8_t)rxDecodeur.octets[rxDecodeur.taille - 2] << 8) |
+                          (uint8_t)rxDecodeur.octets[rxDecodeur.taille - 1];
+                if (CRC16_Compute((const uint8_t *)rxDecodeur.octets,
+                                  rxDecodeur.taille - 2, 0xFFFF) == crcRecu)
+                {
+                    CommitReadFifo(&descrFifoRX, rxDecodeur.taille);
+                    rxDecodeur.etat = RX_RECH_STX;
+                    return 1;
+                }
+                // CRC faux : seul le STX est abandonné
+                AbandonneStx();
+                NbrErreursCrc++;
+                BSP_LEDToggle(BSP_LED_6);
+            }
+        }
+    }
+}
+#endif
+
+
+// Réponse de calibration : statut puis calibration active
+static void RepondCalib(uint8_t type, uint8_t statut)
+{
+    const S_convCalib *pActive;
+    int8_t rep[1 + V2_TAILLE_CALIB];
+
+    rep[0] = statut;
+    pActive = CONV_CalibGet();
+    rep[1] = pActive->oc3Min & 0xFF;
+    rep[2] = pActive->oc3Min >> 8;
+    rep[3] = pActive->oc3Max & 0xFF;
+    rep[4] = pActive->oc3Max >> 8;
+    rep[5] = (uint16_t)pActive->oc3Courbure & 0xFF;
+    rep[6] = (uint16_t)pActive->oc3Courbure >> 8;
+    if (EnvoieTrameV2(type, rep, sizeof(rep)) == 0)
+    {
+        LanceEmission();
+    }
+}
+
+
+// Calibration du servo : appliquée (RAM) si présente, calibration
+// active renvoyée avec le statut
+static void TraiteCalibServo(const int8_t *pDonnees, uint8_t longueur)
+{
+    const uint8_t *pOctets = (const uint8_t *)pDonnees;
+    S_convCalib calib;
+    uint8_t statut = 0;
+
+    if (longueur == V2_TAILLE_CALIB)
+    {
+        calib.oc3Min = pOctets[0] | ((uint16_t)pOctets[1] << 8);
+        calib.oc3Max = pOctets[2] | ((uint16_t)pOctets[3] << 8);
+        calib.oc3Courbure = (int16_t)(pOctets[4] | ((uint16_t)pOctets[5] << 8));
+        statut = CONV_CalibSet(&calib);
+    }
+    RepondCalib(V2_TYPE_CALIB_SERVO, statut);
+}
+
+
+// Traite une commande (message 5 octets ou commande d'une trame v2) :
+// diagnostic répondu, consigne contrôlée. Retourne 1 si une consigne
+// valide a été copiée dans pMess, 0 sinon.
+static int TraiteCommande(uint8_t type, const int8_t *pDonnees, uint8_t longueur,
+                          StruMess *pMess)
+{
+    if ((type == V2_TYPE_CONSIGNE) && (longueur == 2))
+    {
+        if (pDonnees[0] == DIAG_CMD)
+        {
+            TraiteDiag((uint8_t)pDonnees[1]);
+        }
+        else if ((pDonnees[0] < -CONSIGNE_VITESSE_MAX) || (pDonnees[0] > CONSIGNE_VITESSE_MAX) ||
+                 (pDonnees[1] < -CONSIGNE_ANGLE_MAX) || (pDonnees[1] > CONSIGNE_ANGLE_MAX))
+        {
+            NbrMessHorsPlage++;
+        }
+        else
+        {
+            pMess->Speed = pDonnees[0];
+            pMess->Angle = pDonnees[1];
+            return 1;
+        }
+    }
+    else if ((type == V2_TYPE_DIAG) && (longueur == 1))
+    {
+        TraiteDiag((uint8_t)pDonnees[0]);
+    }
+    else if ((type == V2_TYPE_DEBIT_OFFRE) && (longueur == 1))
+    {
+        TraiteOffreDebit((uint8_t)pDonnees[0]);
+    }
+    else if ((type == V2_TYPE_DEBIT_SONDE) && (longueur == RS232_TAILLE_SONDE))
+    {
+        TraiteSondeDebit(pDonnees);
+    }
+    else if ((type == V2_TYPE_CALIB_SERVO) &&
+             ((longueur == 0) || (longueur == V2_TAILLE_CALIB)))
+    {
+        TraiteCalibServo(pDonnees, longueur);
+    }
+    else if ((type == V2_TYPE_CALIB_SAUVE) && (longueur == 0))
+    {
+        RepondCalib(V2_TYPE_CALIB_SAUVE, CONV_CalibSauve());
+    }
+    return 0;
+}
+
+
+/******************************************************************************
+    Fonction :
+    static int TraiteTrameV2(StruMess *pMess)
+
+    Résumé :
+    Exploite la trame v2 valide du décodeur.
+
+    Description :
+    Le numéro de séquence est comparé au précédent : une trame répétée est
+    ignorée, un saut compte les trames perdues (pas de contrôle sur la
+    première trame après le retour en local). Une trame de type lot contient
+    plusieurs commandes (type, longueur, données) traitées dans l'ordre ;
+    un enregistrement qui déborde de la trame arrête le traitement.
+
+    Retour :
+    1 si une consigne valide a été copiée dans pMess (la dernière du lot),
+    0 sinon.
+******************************************************************************/
+static int TraiteTrameV2(StruMess *pMess)
+{
+    uint8_t type = (uint8_t)rxDecodeur.octets[2];
+    uint8_t seq = (uint8_t)rxDecodeur.octets[3];
+    uint8_t longueur = (uint8_t)rxDecodeur.octets[4];
+    const int8_t *pDonnees = &rxDecodeur.octets[V2_TAILLE_ENTETE];
+    uint8_t i, lgCmd;
+    int nbConsignes = 0;
+
+    if (SeqRxValide)
+    {
+        if (seq == SeqRx)
+        {
+            NbrTramesDupliquees++;
+            return 0;
+        }
+        NbrTramesPerdues += (uint8_t)(seq - SeqRx - 1);
+    }
+    SeqRx = seq;
+    SeqRxValide = 1;
+    ModeV2 = 1;
+
+    if (type != V2_TYPE_LOT)
+    {
+        return TraiteCommande(type, pDonnees, longueur, pMess);
+    }
+    i = 0;
+    while (i + 2 <= longueur)
+    {
+        lgCmd = (uint8_t)pDonnees[i + 1];
+        if (i + 2 + lgCmd > longueur)
+        {
+            break;
+        }
+        nbConsignes += TraiteCommande((uint8_t)pDonnees[i], &pDonnees[i + 2], lgCmd, pMess);
+        i += 2 + lgCmd;
+    }
+    if (nbConsignes > 1)
+    {
+        NbrMessRemplaces += nbConsignes - 1;
+    }
+    return (nbConsignes > 0);
+}
+
+
+// Décode le prochain message de consigne, les commandes de diagnostic
+// rencontrées sont traitées au passage et les consignes hors plage
+// (CRC juste mais vitesse ou angle invalide) sont ignorées
+// (retour comme DecodeMessage, pMess n'est modifié que par une consigne
+// valide : le dernier message appliqué n'est pas écrasé)
+static int DecodeConsigne(StruMess *pMess)
+{
+    StruMess mess;
+
+    while (DecodeMessage() == 1)
+    {
+        DebitSilence = 0;
+        if (rxDecodeur.octets[0] == STX_V2_code)
+        {
+            if (TraiteTrameV2(&mess) == 0)
+            {
+                continue;
+            }
+        }
+        else if (TraiteCommande(V2_TYPE_CONSIGNE, &rxDecodeur.octets[1], 2, &mess) == 0)
+        {
+            continue;
+        }
+        *pMess = mess;
+        return 1;
+    }
+    return 0;
+}
+
+
 // Initialisation de la communication sérielle
 void InitFifoComm(void)
 {    
-    // Initialisation du fifo de réception
+    // Initialisation du fifo de réception et du décodeur
     InitFifo ( &descrFifoRX, FIFO_RX_SIZE, fifoRX, 0 );
+#if CRC16_BACKEND_DMA
+    // CRC des messages reçus et émis par le générateur CRC du DMA
+    CRC16_SelectBackend(&CRC16_BackendDma);
+#else
+    CRC16_SelectBackend(&CRC16_BackendTable);
+#endif
+    rxDecodeur.etat = RX_RECH_STX;
+    rxDecodeur.nbRecus = 0;
+    COBS_DecodeInit(&rxDecodeur.cobs, rxDecodeur.octets, V2_TAILLE_MAX);
+    NbrCycle = 0;
+    CommStatus = 0;
+    ModeV2 = 0;
+    SeqRxValide = 0;
+    DebitMasque = DebitMasqueCarte();
+    DebitEtat = DEBIT_REPOS;
+    ChangeDebit(RS232_DEBIT_DEFAUT);
+#if RS232_RX_DMA
+    // Les octets reçus sont copiés par DMA, plus d'interruption RX
+    PLIB_INT_SourceDisable(INT_ID_0, INT_SOURCE_USART_1_RECEIVE);
+    DMAUART_RxInit(&descrFifoRX);
+#else
+    // Interruption RX au seuil choisi du fifo HW (8 niveaux)
+    PLIB_USART_ReceiverInterruptModeSelect(USART_ID_1, RX_MODE_FIFO_HW);
+#endif
     // Initialisation du fifo d'émission
     InitFifo ( &descrFifoTX, FIFO_TX_SIZE, fifoTX, 0 );
+#if RS232_TX_DMA
+    // Emission par DMA, interruption de fin de bloc du canal TX
+    DMAUART_TxInit();
+    PLIB_INT_VectorPrioritySet(INT_ID_0, INT_VECTOR_DMA1, INT_PRIORITY_LEVEL5);
+    PLIB_INT_VectorSubPrioritySet(INT_ID_0, INT_VECTOR_DMA1, INT_SUBPRIORITY_LEVEL0);
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_DMA_1);
+    PLIB_INT_SourceEnable(INT_ID_0, INT_SOURCE_DMA_1);
+#endif
     
     // Init RTS 
     RS232_RTS = 1;   // interdit émission par l'autre
@@ -107,67 +881,57 @@ int GetMessage(S_pwmSettings *pData)
     // Traitement de réception à introduire ICI
     // Lecture et décodage fifo réception
     // ...
-    uint8_t NbCharToRead = 0;
-    static uint8_t NbrCycle = 0;
-    static uint8_t CommStatus = 0;
-    uint32_t ValCRC = 0xFFFF;
-    U_manip16 CRC16;
-    
-    // Obtient le nombre de caractères à lire depuis le FIFO de réception.
-    NbCharToRead = GetReadSize(&descrFifoRX);
+    StruMess RxMess = { 0 };
+    uint8_t NbMessRecus = 0;
     
-    // Obtient le caractère de début du message depuis le FIFO de réception.
-    GetCharFromFifo(&descrFifoRX, &RxMess.Start);
-
-    // Obtention du nombre d'octets dans le FIFO et mettre cette valeur dans NbCharToRead 
-    // Vérifie si suffisamment de caractères ont été reçus et si le caractère de début est correct.
-    if ((NbCharToRead >= MESS_SIZE) && (RxMess.Start == STX_code))
-    {
-        // Obtient les caractères de vitesse, d'angle et de CRC depuis le FIFO de réception.
-        GetCharFromFifo(&descrFifoRX, &RxMess.Speed);
-        GetCharFromFifo(&descrFifoRX, &RxMess.Angle);	 
-        GetCharFromFifo(&descrFifoRX, &RxMess.MsbCrc);
-        GetCharFromFifo(&descrFifoRX, &RxMess.LsbCrc);
-
-        // Calcule la valeur du CRC16 à partir des octets reçus.
-        CRC16.shl.lsb = RxMess.LsbCrc;
-        CRC16.shl.msb = RxMess.MsbCrc;
-        
-
-        // Met à jour la valeur CRC16 en ajoutant les octets du message.
-        ValCRC = updateCRC16(ValCRC, RxMess.Start);
-        ValCRC = updateCRC16(ValCRC, RxMess.Speed);
-        ValCRC = updateCRC16(ValCRC, RxMess.Angle);
+#if RS232_RX_DMA
+    // Publication des octets copiés par le DMA depuis le dernier cycle
+    DMAUART_RxUpdate(&descrFifoRX);
+#elif RS232_RX_SEUIL_FIFO_HW > 1
+    // Octets restés sous le seuil du fifo HW en fin de rafale : le flag
+    // RX est forcé quand le récepteur est au repos, l'interruption les
+    // vide (elle reste le seul producteur du fifo RX)
+    if (PLIB_USART_ReceiverIsIdle(USART_ID_1) &&
+        PLIB_USART_ReceiverDataIsAvailable(USART_ID_1))
+    {
+        PLIB_INT_SourceFlagSet(INT_ID_0, INT_SOURCE_USART_1_RECEIVE);
+    }
+#endif
 
-        // Vérifie si le CRC16 calculé correspond au CRC16 reçu.
-        if (ValCRC == CRC16.val)
-        {   
-            // Met à jour les paramètres de l'angle et de la vitesse avec les valeurs reçues.
-            pData->AngleSetting = RxMess.Angle;
-            pData->SpeedSetting = RxMess.Speed;
+    // Décodage des octets du FIFO de réception (message partiel conservé entre 2 appels).
+#if RX_DRAIN_TO_LATEST
+    // Tous les messages complets sont décodés, seul le dernier est appliqué.
+    while (DecodeConsigne(&RxMess) == 1)
+    {
+        NbMessRecus++;
+    }
+    if (NbMessRecus > 1)
+    {
+        NbrMessRemplaces += NbMessRecus - 1;
+    }
+#else
+    NbMessRecus = DecodeConsigne(&RxMess);
+#endif
+    if (NbMessRecus > 0)
+    {
+        // Met à jour les paramètres de l'angle et de la vitesse avec les valeurs reçues.
+        pData->AngleSetting = RxMess.Angle;
+        pData->SpeedSetting = RxMess.Speed;
 
-            // Calcule la valeur absolue de la vitesse.
-            if(pData->SpeedSetting < 0)
-            {
-                pData->absSpeed = RxMess.Speed * -1;
-            }
-            else
-            {
-                pData->absSpeed = RxMess.Speed;
-            }
-            // Réinitialise le nombre de cycles et le statut de la communication.
-            NbrCycle = 0;
-            CommStatus = 1;
+        // Calcule la valeur absolue de la vitesse.
+        if(pData->SpeedSetting < 0)
+        {
+            pData->absSpeed = RxMess.Speed * -1;
         }
-        
-        // Si la CRC16 ne correspond pas et si le nombre de cycles n'a pas atteint 10, incrémente le nombre de cycles.
-        else if (NbrCycle < CYCLE_MAX)
+        else
         {
-            BSP_LEDToggle(BSP_LED_6);
-            NbrCycle++;
+            pData->absSpeed = RxMess.Speed;
         }
+        // Réinitialise le nombre de cycles et le statut de la communication.
+        NbrCycle = 0;
+        CommStatus = 1;
     }    
-    // Si le nombre de cycles n'a pas atteint 10 et si le message est incomplet, incrémente le nombre de cycles.
+    // Si le nombre de cycles n'a pas atteint 10 et si aucun message complet n'est reçu, incrémente le nombre de cycles.
     else
     {
         if (NbrCycle < CYCLE_MAX)
@@ -175,22 +939,92 @@ int GetMessage(S_pwmSettings *pData)
             NbrCycle++;
         }
         // Si le nombre de cycles atteint 10, réinitialise le statut de la communication et le nombre de cycles.
+        // Plus de consigne : retour au message 5 octets (le débit
+        // négocié est abandonné par GereDebit sans aucune trame).
         else
         {
             CommStatus = 0;
             NbrCycle = 0;
+            ModeV2 = 0;
+            SeqRxValide = 0;
         }
     }
+    // Négociation du débit en cours
+    GereDebit();
     // Gestion controle de flux de la réception
     if(GetWriteSpace ( &descrFifoRX) >= (2*MESS_SIZE))
     {
         // autorise émission par l'autre
         RS232_RTS = 0;
     }
+#if RS232_RX_DMA
+    // Sans interruption RX, la demande d'arrêt est gérée ici
+    else
+    {
+        RS232_RTS = 1;
+    }
+#endif
     return CommStatus;
 } // GetMessage
 
 
+/******************************************************************************
+    Fonction :
+    uint8_t RS232_EtatCoherent(void)
+
+    Résumé :
+    Contrôle de l'état interne de la communication.
+
+    Description :
+    Vérifie que les descripteurs des fifos désignent toujours leur buffer
+    et que les index n'en sortent pas, que le décodeur est dans un état
+    connu avec ses octets examinés présents dans le fifo RX, et que le
+    compteur de cycles et le mode restent dans leurs plages. Appelée par
+    le banc de fuzzing de la simulation PC après chaque opération.
+
+    Retour :
+    1 si l'état est cohérent, 0 sinon.
+******************************************************************************/
+uint8_t RS232_EtatCoherent(void)
+{
+    if ((descrFifoRX.pBuf != fifoRX) || (descrFifoRX.mask != descrFifoRX.size - 1) ||
+        (descrFifoRX.size > FIFO_RX_SIZE) ||
+        ((uint32_t)(descrFifoRX.head - descrFifoRX.tail) > descrFifoRX.size))
+    {
+        return 0;
+    }
+    if ((descrFifoTX.pBuf != fifoTX) || (descrFifoTX.mask != descrFifoTX.size - 1) ||
+        (descrFifoTX.size > FIFO_TX_SIZE) ||
+        ((uint32_t)(descrFifoTX.head - descrFifoTX.tail) > descrFifoTX.size))
+    {
+        return 0;
+    }
+#if RS232_COBS
+    // octets déjà consommés, seule la trame décodée est bornée
+    if ((rxDecodeur.cobs.pDest != rxDecodeur.octets) ||
+        (rxDecodeur.cobs.tailleMax != V2_TAILLE_MAX) ||
+        (rxDecodeur.cobs.nb > V2_TAILLE_MAX))
+    {
+        return 0;
+    }
+#endif
+    if (rxDecodeur.etat == RX_COLLECTE)
+    {
+        if ((rxDecodeur.taille > V2_TAILLE_MAX) || (rxDecodeur.nbRecus == 0) ||
+            (rxDecodeur.nbRecus >= rxDecodeur.taille) ||
+            (rxDecodeur.nbRecus > GetReadSize(&descrFifoRX)))
+        {
+            return 0;
+        }
+    }
+    else if (rxDecodeur.etat != RX_RECH_STX)
+    {
+        return 0;
+    }
+    return (NbrCycle <= CYCLE_MAX) && (CommStatus <= 1);
+}
+
+
 /******************************************************************************
     Auteur : CFO
  *
@@ -205,6 +1039,9 @@ int GetMessage(S_pwmSettings *pData)
     La fonction calcule un nouveau CRC16 basé sur les paramètres de vitesse et d'angle de la structure pData.
     Elle stocke ensuite ce CRC16 avec les données dans une structure TxMess.
     Si l'espace est disponible dans le FIFO de transmission, elle y écrit les données.
+    Une fois le protocole v2 activé par le partenaire, la consigne part dans une
+    trame v2 de type consigne, numérotée par SeqTx. Pendant un changement de
+    débit, rien n'est ajouté avant que l'acceptation soit entièrement émise.
     De plus, elle gère le contrôle de flux en activant une interruption de transmission
     lorsque la broche de demande de transmission (CTS) est désactivée et qu'il y a de l'espace disponible dans le FIFO.
  *
@@ -215,61 +1052,78 @@ int GetMessage(S_pwmSettings *pData)
 // Fonction d'envoi des messages, appel cyclique
 void SendMessage(S_pwmSettings *pData)
 {
-    int8_t freeSize;
+    int32_t freeSize;   // 32 bits : FIFO_TX_SIZE peut dépasser 127
     uint32_t NewCRC = 0xFFFF;
+    int8_t consigne[2];
     // Traitement émission à introduire ICI
     // Formatage message et remplissage fifo émission
     // Obtient l'espace disponible dans le FIFO de transmission.
     freeSize = GetWriteSpace(&descrFifoTX);
 
+    if (ModeV2)
+    {
+        // rien de plus avant le changement de débit (négociation en v2)
+        if (DebitEtat != DEBIT_ATTENTE_EMISSION)
+        {
+            consigne[0] = pData->SpeedSetting;
+            consigne[1] = pData->AngleSetting;
+            EnvoieTrameV2(V2_TYPE_CONSIGNE, consigne, sizeof(consigne));
+        }
+    }
     // Vérifie si suffisamment d'espace est disponible dans le FIFO pour écrire le message complet.
-    if(freeSize >= MESS_SIZE)
+    else if(freeSize >= MESS_SIZE)
     {
-        // Calcule le nouveau CRC16 à partir des paramètres de vitesse et d'angle.
-        NewCRC = updateCRC16(NewCRC, STX_code);
-        NewCRC = updateCRC16(NewCRC, pData->SpeedSetting);
-        NewCRC = updateCRC16(NewCRC, pData->AngleSetting);
+        // Remplit la structure TxMess avec les paramètres.
+        TxMess.Start = STX_code;
+        TxMess.Speed = pData->SpeedSetting;
+        TxMess.Angle = pData->AngleSetting;
+
+        // Calcule le nouveau CRC16 sur Start, Speed et Angle (backend CRC sélectionné).
+        NewCRC = CRC16_Compute((const uint8_t *)&TxMess, MESS_SIZE - 2, NewCRC);
 
         // Sépare le CRC16 en octets MSB et LSB.
         TxMess.MsbCrc = (NewCRC & 0xFF00) >> 8;
         TxMess.LsbCrc = NewCRC & 0x00FF;
 
-        // Remplit la structure TxMess avec les paramètres et le CRC16.
-        TxMess.Start = STX_code;
-        TxMess.Speed = pData->SpeedSetting;
-        TxMess.Angle = pData->AngleSetting;
-
-        // Écrit chaque élément de la structure TxMess dans le FIFO de transmission.
-        PutCharInFifo(&descrFifoTX, TxMess.Start);
-        PutCharInFifo(&descrFifoTX, TxMess.Speed);
-        PutCharInFifo(&descrFifoTX, TxMess.Angle);
-        PutCharInFifo(&descrFifoTX, TxMess.MsbCrc);
-        PutCharInFifo(&descrFifoTX, TxMess.LsbCrc);
+        // Écrit la structure TxMess complète dans le FIFO de transmission.
+        EnvoieTrame((int8_t *)&TxMess, MESS_SIZE);
     }    
     // Gestion du controle de flux
-    // si on a un caractère à envoyer et que CTS = 0
-    freeSize = GetWriteSpace(&descrFifoTX);
-    if ((RS232_CTS == 0) && (freeSize > 0))
-    {        
-        // Autorise int émission    
-        PLIB_INT_SourceEnable(INT_ID_0, INT_SOURCE_USART_1_TRANSMIT);                
-    }
+    LanceEmission();
 }
 
 
+#if RS232_TX_DMA
+// Interruption fin de bloc du canal DMA d'émission
+void __ISR(_DMA_1_VECTOR, ipl5AUTO) _IntHandlerDmaUartTx(void)
+{
+    ISRP_ENTREE(ISRP_DMA_TX);
+    // Marque début interruption avec Led3
+    LED3_W = 1;
+    // morceau émis consommé, le suivant est lancé si CTS = 0
+    // (sinon la reprise se fait dans SendMessage)
+    DMAUART_TxBlocTermine(&descrFifoTX, RS232_CTS == 0);
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_DMA_1);
+    // Marque fin interruption avec Led3
+    LED3_W = 0;
+    ISRP_SORTIE(ISRP_DMA_TX);
+}
+#endif
+
+
 // Interruption USART1
 // !!!!!!!!
 // Attention ne pas oublier de supprimer la réponse générée dans system_interrupt
 // !!!!!!!!
 void __ISR(_UART_1_VECTOR, ipl5AUTO) _IntHandlerDrvUsartInstance0(void)
 {    
-    uint8_t dataAvaliable = 0;
-    uint8_t freeSize, TXSize;
+    uint32_t freeSize, TXSize;  // 32 bits : fifos de 256 octets et plus
     uint8_t byteUsart = 0;
     int8_t c;
     bool TxBuffFull;
     USART_ERROR UsartStatus;
  
+    ISRP_ENTREE(ISRP_USART1);
     // Marque début interruption avec Led3
     LED3_W = 1;
     // Is this an Error interrupt ?
@@ -302,12 +1156,11 @@ void __ISR(_UART_1_VECTOR, ipl5AUTO) _IntHandlerDrvUsartInstance0(void)
             // ...
 
 
-            dataAvaliable = PLIB_USART_ReceiverDataIsAvailable(USART_ID_1);
-            
-            if(dataAvaliable == 1)
+            // Vide tout le fifo HW (plusieurs octets si seuil > 1)
+            while (PLIB_USART_ReceiverDataIsAvailable(USART_ID_1))
             {
                 byteUsart = PLIB_USART_ReceiverByteReceive(USART_ID_1);    
-                PutCharInFifo(&descrFifoRX, byteUsart);
+                SPSC_PutChar(&descrFifoRX, byteUsart);
             }         
             LED4_W = !LED4_R; // Toggle Led4
             // buffer is empty, clear interrupt flag
@@ -327,7 +1180,7 @@ void __ISR(_UART_1_VECTOR, ipl5AUTO) _IntHandlerDrvUsartInstance0(void)
         // Traitement controle de flux reception à faire ICI
         // Gerer sortie RS232_RTS en fonction de place dispo dans fifo reception
         // ...
-        freeSize = GetWriteSpace(&descrFifoRX);
+        freeSize = SPSC_WriteSpace(&descrFifoRX);
         if (freeSize <= TAILLE_MINIMALE_FIFO_RX){
             //controle de flux : demande stop émission
             RS232_RTS = 1 ;
@@ -340,29 +1193,29 @@ void __ISR(_UART_1_VECTOR, ipl5AUTO) _IntHandlerDrvUsartInstance0(void)
  
         // Traitement TX à faire ICI
         // Envoi des caractères depuis le fifo SW -> buffer HW
-        TXSize = GetReadSize (&descrFifoTX);
+        TXSize = SPSC_ReadSize (&descrFifoTX);
         // Avant d'émettre, on vérifie 3 conditions :
         //  Si CTS = 0 autorisation d'émettre (entrée RS232_CTS)
         //  S'il y a un caratères à émettre dans le fifo
         //  S'il y a de la place dans le buffer d'émission (PLIB_USART_TransmitterBufferIsFull)
         //   (envoi avec PLIB_USART_TransmitterByteSend())
         // ...
-         TXSize = GetReadSize (&descrFifoTX);
+         TXSize = SPSC_ReadSize (&descrFifoTX);
          TxBuffFull = PLIB_USART_TransmitterBufferIsFull(USART_ID_1);
          
          if ( (RS232_CTS == 0) && ( TXSize > 0 ) && TxBuffFull == false )
          { 
             do {
-              GetCharFromFifo(&descrFifoTX, &c);
+              SPSC_GetChar(&descrFifoTX, &c);
               PLIB_USART_TransmitterByteSend(USART_ID_1, c);
               BSP_LEDToggle(BSP_LED_6); // pour comptage
-              TXSize = GetReadSize (&descrFifoTX);
+              TXSize = SPSC_ReadSize (&descrFifoTX);
               TxBuffFull = PLIB_USART_TransmitterBufferIsFull(USART_ID_1);
             } while ( (RS232_CTS == 0) && ( TXSize > 0 ) && TxBuffFull == false );
             // Clear the TX interrupt Flag
             // (Seulement aprés TX)
 
-            TXSize = GetReadSize (&descrFifoTX);
+            TXSize = SPSC_ReadSize (&descrFifoTX);
 
             if (TXSize == 0 )
             {
@@ -379,14 +1232,16 @@ void __ISR(_UART_1_VECTOR, ipl5AUTO) _IntHandlerDrvUsartInstance0(void)
          }
     }
         LED5_W = !LED5_R; // Toggle Led5
-        // disable TX interrupt (pour éviter une interrupt. inutile si plus rien à transmettre)
-        PLIB_INT_SourceDisable(INT_ID_0, INT_SOURCE_USART_1_TRANSMIT);
-        
+        // L'interruption TX reste autorisée tant qu'il reste des caractères
+        // et que CTS = 0 (désactivée ci-dessus sinon) : le fifo est vidé au
+        // débit de la ligne et non plus 8 octets par appel de SendMessage.
+
          // Clear the TX interrupt Flag (Seulement apres TX) 
          PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_USART_1_TRANSMIT);
  
     // Marque fin interruption avec Led3
     LED3_W = 0;
+    ISRP_SORTIE(ISRP_USART1);
 }
 
  
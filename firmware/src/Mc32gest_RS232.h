@@ -21,6 +21,144 @@
 // Nombre de cycle maximal pour compteur NbrCycle
 #define CYCLE_MAX 9
 #define TAILLE_MINIMALE_FIFO_RX 6
+// Plages des consignes reçues, un message hors plage est ignoré
+#define CONSIGNE_VITESSE_MAX 99
+#define CONSIGNE_ANGLE_MAX 90
+// 1 : GetMessage décode tous les messages complets du FIFO et n'applique
+//     que le plus récent (latence de commande bornée à un cycle)
+// 0 : un seul message décodé par appel
+#ifndef RX_DRAIN_TO_LATEST
+#define RX_DRAIN_TO_LATEST 1
+#endif
+// 1 : réception par DMA dans le fifo RX (pas d'interruption par octet),
+//     le fifo est mis à jour par GetMessage
+// 0 : réception par l'interruption RX de l'USART1
+#ifndef RS232_RX_DMA
+#define RS232_RX_DMA 0
+#endif
+// 1 : émission par DMA, un transfert par morceau contigu du fifo TX et
+//     une interruption par fin de bloc ; le CTS suspend le canal
+// 0 : émission par l'interruption TX de l'USART1 (un octet à la fois)
+#ifndef RS232_TX_DMA
+#define RS232_TX_DMA 0
+#endif
+// Seuil d'interruption RX du fifo HW de l'USART1 (8 niveaux)
+// 1 : à chaque caractère, 4 : fifo HW à moitié plein, 6 : aux 3/4
+// Au-dessus de 1, les octets restés sous le seuil en fin de rafale
+// sont vidés à l'appel de GetMessage (récepteur au repos)
+// Marge avant débordement : 8 - seuil caractères, soit 7 / 4 / 2
+// caractères (70 / 40 / 20 us à 1 Mbaud, 10 us par caractère) pour
+// servir l'interruption. Un débordement efface OERR, donc tout le fifo
+// HW. Un seuil plus haut réduit le nombre d'interruptions mais ne
+// supporte pas les interruptions masquées (effacement de la flash,
+// voir Mc32Nvm.h) : 1 tant que des mesures sur la cible ne justifient
+// pas un autre seuil.
+#ifndef RS232_RX_SEUIL_FIFO_HW
+#define RS232_RX_SEUIL_FIFO_HW 1
+#endif
+// 1 : chaque message (5 octets, v2, réponse de diagnostic) est encodé
+//     COBS et suivi d'un délimiteur 0x00 (voir Mc32Cobs.h) : un début
+//     de trame ne se confond plus avec les données, resynchronisation
+//     au délimiteur suivant. Le partenaire doit utiliser le même tramage.
+// 0 : messages bruts, recherche du STX
+#ifndef RS232_COBS
+#define RS232_COBS 0
+#endif
+// 1 : CRC16 des messages (émission et contrôle à la réception) par le
+//     générateur CRC du DMA (CRC16_BackendDma, canal CRC16_DMA_CHANNEL),
+//     calcul synchrone, le CPU attend la fin du transfert
+// 0 : CRC16 par tables (crc16_ccitt)
+#ifndef CRC16_BACKEND_DMA
+#define CRC16_BACKEND_DMA 0
+#endif
+
+// Commandes de diagnostic : message normal (STX 0xAA + CRC) dont le
+// champ Speed vaut DIAG_CMD (hors plage -99..99), le champ Angle donne
+// le numéro de la donnée demandée. Le message n'est pas appliqué comme
+// consigne. Réponse :
+//   0xA5, id, longueur, données (little endian), CRC16 MSB, LSB
+// (CRC16 calculé de 0xA5 à la fin des données)
+#define DIAG_CMD (-128)
+// id 0x00..0x0F : interruptions, id = 4 * vecteur + page
+//   page 0 : durée nb/min/max/moy (ticks 25 ns), 1 : histogramme durée
+//   page 2 : latence nb/min/max/moy,             3 : remise à zéro
+#define DIAG_ID_ISR 0x00
+// id 0x10..0x1B : boucle principale, id = 0x10 + 2 * étape + page
+//   (dernière fenêtre de CYCP_FENETRE cycles, voir Mc32Profil.h)
+//   page 0 : durée nb/min/max/moy (ticks 25 ns), 1 : histogramme durée
+// id 0x1C : dépassements, ticks manqués / hors budget / cycles (3 x u32)
+// id 0x1D : remise à zéro
+#define DIAG_ID_CYCLE 0x10
+#define DIAG_ID_DEPASSEMENTS 0x1C
+#define DIAG_ID_CYCLE_RAZ 0x1D
+// id 0x1E : communication, erreurs CRC / remplacés / hors plage /
+//   erreurs format v2 / trames perdues / trames répétées / débit /
+//   négociations de débit échouées (8 x u32)
+#define DIAG_ID_COMM 0x1E
+#define DIAG_TAILLE_MAX 32
+
+// Trame v2 :
+//   0xAB, version, type, séquence, longueur, données, CRC16 MSB, LSB
+// (CRC16 calculé de 0xAB à la fin des données). Le message 5 octets
+// (0xAA) reste accepté ; la carte répond en v2 dès qu'elle reçoit une
+// trame v2 et revient au message 5 octets au retour en local.
+// Séquence : +1 par trame, une trame répétée est ignorée, un saut
+// compte les trames perdues (voir DIAG_ID_COMM).
+#define V2_VERSION 2
+#define V2_TAILLE_ENTETE 5
+#define V2_DONNEES_MAX 16
+#define V2_TAILLE_MAX (V2_TAILLE_ENTETE + V2_DONNEES_MAX + 2)
+// Types : consigne (vitesse, angle), diagnostic (id, réponse 0xA5),
+// lot : suite de commandes (type, longueur, données) dans une trame
+#define V2_TYPE_CONSIGNE 0x01
+#define V2_TYPE_DIAG 0x02
+#define V2_TYPE_LOT 0x03
+
+// Négociation du débit (trames v2). La liaison démarre à
+// RS232_DEBIT_DEFAUT :
+//   PC -> carte  DEBIT_OFFRE   : masque u8 des débits du PC
+//                                (bit i : 57600, 115200, 230400,
+//                                460800, 921600, 1000000)
+//   carte -> PC  DEBIT_ACCEPTE : index (u8), débit (u32) : le plus
+//                                haut débit commun ; les deux côtés
+//                                changent de débit après cette trame
+//   PC -> carte  DEBIT_SONDE   : 55 AA 00 FF 0F F0 33 CC au nouveau débit
+//   carte -> PC  DEBIT_SONDE   : même contenu, débit confirmé
+// Sans sonde valide dans RS232_SONDE_CYCLES cycles, ou après
+// CYCLE_MAX + 1 cycles sans aucune trame valide, la carte revient au
+// débit par défaut.
+#define V2_TYPE_DEBIT_OFFRE 0x04
+#define V2_TYPE_DEBIT_ACCEPTE 0x05
+#define V2_TYPE_DEBIT_SONDE 0x06
+#define RS232_DEBIT_DEFAUT 57600
+// Débit maximal proposé par la carte (1 Mbaud : BRGH, BRG = 19)
+#define RS232_DEBIT_MAX 1000000
+// Erreur de débit admise en pour mille (générateur de débit)
+#define RS232_DEBIT_ERREUR_MAX 20
+#define RS232_SONDE_CYCLES 5
+#define RS232_NB_DEBITS 6
+#define RS232_TAILLE_SONDE 8
+
+// Calibration du servo (trame v2, voir Mc32ConvPwm.h) :
+//   PC -> carte  CALIB_SERVO : vide (lecture) ou min u16, max u16,
+//                              courbure i16 (little endian)
+//   carte -> PC  CALIB_SERVO : statut u8 (0 : OK, 1 : refusée),
+//                              puis la calibration active (6 octets)
+// Si la calibration change, la table de l'impulsion OC3 est
+// reconstruite. La calibration reste en RAM (réglage interactif sans
+// écriture de flash) et est perdue au redémarrage si elle n'est pas
+// sauvegardée :
+//   PC -> carte  CALIB_SAUVE : vide
+//   carte -> PC  CALIB_SAUVE : statut u8 (0 : sauvegardée, 1 : erreur
+//                              d'écriture), puis la calibration active
+// La calibration active est écrite en flash et rechargée au démarrage.
+// L'effacement de la page arrête le CPU ~20 ms (quelques octets reçus
+// peuvent être perdus, ticks de 20 ms retardés) et la page ne supporte
+// qu'environ 1000 effacements : à envoyer une fois le réglage terminé.
+// Rien n'est écrit si la flash contient déjà cette calibration.
+#define V2_TYPE_CALIB_SERVO 0x07
+#define V2_TYPE_CALIB_SAUVE 0x08
+#define V2_TAILLE_CALIB 6
 /*--------------------------------------------------------*/
 // Définition des fonctions prototypes
 /*--------------------------------------------------------*/
@@ -29,9 +167,21 @@
 void InitFifoComm(void);
 int GetMessage(S_pwmSettings *pData);
 void SendMessage(S_pwmSettings *pData);
+// Contrôle de l'état interne (fifos, décodeur, mode), 1 si cohérent
+uint8_t RS232_EtatCoherent(void);
 
 // Descripteur des fifos
 extern S_fifo descrFifoRX;
 extern S_fifo descrFifoTX;
 
+// Statistiques de réception
+extern uint32_t NbrErreursCrc;      // messages rejetés sur erreur de CRC
+extern uint32_t NbrMessRemplaces;   // messages valides remplacés par un plus récent
+extern uint32_t NbrMessHorsPlage;   // messages valides rejetés, consigne hors plage
+extern uint32_t NbrErreursFormat;   // trames v2 de version ou longueur invalide
+extern uint32_t NbrTramesPerdues;   // trames v2 manquantes (séquence)
+extern uint32_t NbrTramesDupliquees;    // trames v2 répétées (séquence)
+extern uint32_t RS232_Debit;        // débit actuel de la ligne
+extern uint32_t NbrDebitsEchoues;   // négociations sans sonde valide
+
 #endif
@@ -55,6 +55,7 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 
 #include "app.h"
 #include "Mc32gest_RS232.h"
+#include "Mc32Profil.h"
 #include <stdint.h>
 #include "gestPWM.h"
 
@@ -120,6 +121,8 @@ void callback_timer1(void)
         }
         else
         {
+            // Cycle précédent pas terminé : dépassement du budget de 20 ms
+            CYCP_Tick(appData.state == APP_STATE_SERVICE_TASKS);
             APP_UpdateState(APP_STATE_SERVICE_TASKS);
         }
 }
@@ -222,6 +225,9 @@ void APP_Initialize ( void )
     /* Place the App state machine in its initial state. */
     appData.state = APP_STATE_INIT;
     
+    // Statistiques des interruptions et de la boucle principale à zéro
+    ISRP_Init();
+    CYCP_Init();
     
     /* TODO: Initialize your application's state machine and other
      * parameters.
@@ -256,7 +262,7 @@ void APP_Tasks(void)
                 lcd_bl_on();
                 
                 // Initialisation du convertisseur analogique-numérique
-                BSP_InitADC10Alt();
+                GPWM_InitADC();
              
                 // Éteint toutes les LEDs
                 EteindreLEDS();
@@ -270,7 +276,7 @@ void APP_Tasks(void)
                 printf_lcd("Cyril Feliciano");
         
                 // Initialise le générateur de PWM
-                GPWM_Initialize(&pData);
+                GPWM_Initialize(&PWMData);
                 // Initialise la Fifo
                 InitFifoComm();
                 // Incrémente le compteur d'initialisation pour n'exécuter ces étapes qu'une seule fois
@@ -285,9 +291,12 @@ void APP_Tasks(void)
         case APP_STATE_SERVICE_TASKS:
         {
 
+            // Mesure du temps de chaque étape du cycle
+            CYCP_Debut();
                      
             // Réception param. remote
             CommStatus = GetMessage(&PWMData);
+            CYCP_Etape(CYCP_GET_MESSAGE);
             if (CommStatus == 0) // Si c'est local.
             {
               GPWM_GetSettings(&PWMData); // Obtient les paramètres locaux.
@@ -296,12 +305,15 @@ void APP_Tasks(void)
             {
               GPWM_GetSettings(&PWMDataToSend); // Obtient les paramètres à distance.
             }
+            CYCP_Etape(CYCP_GET_SETTINGS);
 
             // Affichage des paramètres sur un écran.
             GPWM_DispSettings(&PWMData, CommStatus);
+            CYCP_Etape(CYCP_DISP_SETTINGS);
 
             // Exécution du PWM et gestion du moteur en utilisant les paramètres obtenus.
             GPWM_ExecPWM(&PWMData);
+            CYCP_Etape(CYCP_EXEC_PWM);
 
             // Envoi périodique des données si nécessaire.
             if(comptSend >= COMPTEUR_5_CYCLES_ENVOIE) // Si le compteur d'envoi atteint 5.
@@ -320,6 +332,8 @@ void APP_Tasks(void)
             {
                 comptSend++; // Incrémentation du compteur d'envoi.
             }
+            CYCP_Etape(CYCP_SEND_MESSAGE);
+            CYCP_Fin();
             
             appData.state = APP_STATE_WAIT; // Changement d'état de l'application vers l'état d'attente.
 
@@ -62,7 +62,7 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 #include "bsp.h"
 #include "Mc32DriverAdcAlt.h"
 #include "Mc32DriverLcd.h"
-#include "C:\microchip\harmony\v2_06\bsp\pic32mx_skes\Mc32DriverAdc.h"
+#include "Mc32DriverAdc.h"
 #include "gestPWM.h"
 
 // DOM-IGNORE-BEGIN
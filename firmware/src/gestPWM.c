@@ -9,12 +9,24 @@
 //	Version		:	V1.1
 //	Compilateur	:	XC32 V1.42 + Harmony 1.08
 //
+//  CFO 17.10.2026 moyenne ADC à somme courante (Mc32Filtre)
+//  CFO 17.10.2026 chaîne de filtres par canal (Mc32Filtre)
+//  CFO 17.10.2026 acquisition ADC continue par DMA (ADC_DMA)
+//  CFO 17.10.2026 conversions en virgule fixe (Mc32ConvPwm)
+//  CFO 17.10.2026 impulsion du servo par table calibrée
 /*--------------------------------------------------------*/
 
-#include "GestPWM.h"
+#include "gestPWM.h"
+#include "Mc32Filtre.h"
+#include "Mc32AdcDma.h"
+#include "Mc32ConvPwm.h"
+#include "Mc32Profil.h"
 #include <stdint.h>
 #include <math.h>
 
+// Chaîne de filtres de chaque canal (vitesse, angle)
+static S_filtreCanal filtre_ADC1, filtre_ADC2;
+
 
 // *****************************************************************************
 /* Fonction :
@@ -48,6 +60,9 @@ void GPWM_Initialize(S_pwmSettings *pData)
     
     // Initialise l'état du pont en H
     BSP_EnableHbrige();
+
+    // Facteurs de conversion, OC2 selon la période du timer 2
+    CONV_Init(DRV_TMR1_PeriodValueGet());
     
     // Lance les timers et les sorties de comparaison (OC - Output Compare)
     DRV_TMR0_Start();
@@ -58,6 +73,38 @@ void GPWM_Initialize(S_pwmSettings *pData)
     DRV_OC1_Start();
 }
 
+// *****************************************************************************
+/* Fonction :
+    void GPWM_InitADC(void)
+
+  Résumé :
+    Initialise le convertisseur AD et les filtres des potentiomètres.
+
+  Description :
+    Remet à zéro la chaîne de filtres de chaque canal puis configure
+    l'acquisition : lecture à la demande (BSP_InitADC10Alt) ou, avec
+    ADC_DMA, balayage continu des 2 entrées copié par DMA dans des blocs
+    ping-pong, consommés dans l'interruption du canal DMA.
+
+*/
+// *****************************************************************************
+
+void GPWM_InitADC(void)
+{
+    FILTRE_CanalInit(&filtre_ADC1, 0);
+    FILTRE_CanalInit(&filtre_ADC2, 0);
+#if ADC_DMA
+    // Interruption de bloc du canal DMA, sous le timer 1 et l'USART1
+    PLIB_INT_VectorPrioritySet(INT_ID_0, INT_VECTOR_DMA3, INT_PRIORITY_LEVEL3);
+    PLIB_INT_VectorSubPrioritySet(INT_ID_0, INT_VECTOR_DMA3, INT_SUBPRIORITY_LEVEL0);
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_DMA_3);
+    PLIB_INT_SourceEnable(INT_ID_0, INT_SOURCE_DMA_3);
+    ADCDMA_Init();
+#else
+    BSP_InitADC10Alt();
+#endif
+}
+
 // *****************************************************************************
 /* Fonction :
     void GPWM_GetSettings(S_pwmSettings *pData)
@@ -68,10 +115,12 @@ void GPWM_Initialize(S_pwmSettings *pData)
   Description :
     Cette fonction récupère les valeurs de vitesse et d'angle à partir du
     convertisseur analogique-numérique (AD). Elle lit les valeurs du canal 0
-    (vitesse) et du canal 1 (angle) du convertisseur AD, effectue une moyenne
-    sur un certain nombre d'échantillons (défini par TAILLE_MOYENNE_ADC) pour
-    réduire les variations du signal, puis effectue une conversion en unités
-    appropriées.
+    (vitesse) et du canal 1 (angle) du convertisseur AD, les fait passer
+    dans la chaîne de filtres de Mc32Filtre (par défaut une moyenne
+    glissante sur 8 échantillons) pour réduire les variations du signal,
+    puis effectue une conversion en unités appropriées.
+    Avec ADC_DMA, les échantillons sont filtrés par blocs dans
+    l'interruption du canal DMA : seule la valeur filtrée est lue.
 
   Paramètres :
     - pData : Un pointeur vers la structure de paramètres PWM (S_pwmSettings)
@@ -82,47 +131,33 @@ void GPWM_Initialize(S_pwmSettings *pData)
 
 void GPWM_GetSettings(S_pwmSettings *pData)	
 {
-    // Lecture du convertisseur AD
-    static uint32_t valeur_ADC1[TAILLE_MOYENNE_ADC] = {0};
-    static uint32_t valeur_ADC2[TAILLE_MOYENNE_ADC] = {0};
-    static uint32_t i = 0;
-    uint8_t n;
-    uint32_t somme1 = 0;
-    uint32_t somme2 = 0;
     uint32_t moyen_ADC1, moyen_ADC2;
     int32_t valeur_variant_ADC1, valeur_variant_ADC2;
+#if ADC_DMA == 0
     APP_DATA appData;
 
     // Lire les valeurs du convertisseur analogique-numérique
     appData.AdcRes = BSP_ReadADCAlt();
-    valeur_ADC1[i] = appData.AdcRes.Chan0;
-    valeur_ADC2[i] = appData.AdcRes.Chan1;
-    i++;
-    if (i > 9)
-    {
-        i = 0;
-    }
 
-    // Calculer la moyenne des échantillons pour lisser le signal
-    for (n = 0; n < TAILLE_MOYENNE_ADC; n++)
-    {
-        somme1 += valeur_ADC1[n];
-        somme2 += valeur_ADC2[n];
-    }
-    moyen_ADC1 = somme1 / TAILLE_MOYENNE_ADC;
-    moyen_ADC2 = somme2 / TAILLE_MOYENNE_ADC;
+    // Filtrage des échantillons pour lisser le signal
+    FILTRE_CanalAjoute(&filtre_ADC1, appData.AdcRes.Chan0);
+    FILTRE_CanalAjoute(&filtre_ADC2, appData.AdcRes.Chan1);
+#endif
+    moyen_ADC1 = FILTRE_CanalValeur(&filtre_ADC1);
+    moyen_ADC2 = FILTRE_CanalValeur(&filtre_ADC2);
 
-    // Conversion des valeurs ADC en unités appropriées
-    valeur_variant_ADC1 = ((198 * moyen_ADC1) / 1023) + 0.5;
-    valeur_variant_ADC1 = valeur_variant_ADC1 - 99;
-    valeur_variant_ADC2 = ((180 * moyen_ADC2) / 1023) + 0.5;
+    // Conversion des valeurs ADC en unités appropriées (virgule fixe,
+    // mêmes valeurs que (198 * adc) / 1023 et (180 * adc) / 1023)
+    valeur_variant_ADC1 = CONV_AdcVitesse(moyen_ADC1);
+    valeur_variant_ADC1 = valeur_variant_ADC1 - CONV_VITESSE_MAX;
+    valeur_variant_ADC2 = CONV_AdcAngle(moyen_ADC2);
 
     // Stockage des valeurs converties dans la structure de paramètres
     pData->absAngle = valeur_variant_ADC2;
     valeur_variant_ADC2 = (valeur_variant_ADC2 - 90);
     pData->AngleSetting = valeur_variant_ADC2;
     pData->SpeedSetting = valeur_variant_ADC1;
-    pData->absSpeed = abs(valeur_variant_ADC1);
+    pData->absSpeed = (valeur_variant_ADC1 < 0) ? -valeur_variant_ADC1 : valeur_variant_ADC1;
 }
 
 
@@ -230,30 +265,36 @@ void GPWM_ExecPWM(S_pwmSettings *pData)
 {
     static uint16_t PulseWidthOC2;
     static uint16_t PulseWidthOC3;
+    uint32_t absVitesse;
 
     // Contrôle de l'état du pont en H en fonction de la vitesse
     if (pData->SpeedSetting < 0)
     {
         PLIB_PORTS_PinSet(PORTS_ID_0, AIN1_HBRIDGE_PORT, AIN1_HBRIDGE_BIT);
         PLIB_PORTS_PinClear(PORTS_ID_0, AIN2_HBRIDGE_PORT, AIN2_HBRIDGE_BIT);
+        absVitesse = -pData->SpeedSetting;
     }
     else if (pData->SpeedSetting > 0)
     {
         PLIB_PORTS_PinClear(PORTS_ID_0, AIN1_HBRIDGE_PORT, AIN1_HBRIDGE_BIT);
         PLIB_PORTS_PinSet(PORTS_ID_0, AIN2_HBRIDGE_PORT, AIN2_HBRIDGE_BIT);
+        absVitesse = pData->SpeedSetting;
     }
     else
     {
         PLIB_PORTS_PinClear(PORTS_ID_0, AIN1_HBRIDGE_PORT, AIN1_HBRIDGE_BIT);
         PLIB_PORTS_PinClear(PORTS_ID_0, AIN2_HBRIDGE_PORT, AIN2_HBRIDGE_BIT);
+        absVitesse = 0;
     }
 
     // Calcul de la largeur d'impulsion (Pulse Width) pour la sortie OC2 en fonction de la vitesse
-    PulseWidthOC2 = (abs(pData->SpeedSetting) * DRV_TMR1_PeriodValueGet()) / 100;
+    // (|vitesse| * période du timer 2) / 100, facteur recalculé par CONV_PeriodeSet
+    PulseWidthOC2 = CONV_VitesseOc2(absVitesse);
     PLIB_OC_PulseWidth16BitSet(OC_ID_2, PulseWidthOC2);
 
-    // Calcul de la largeur d'impulsion (Pulse Width) pour la sortie OC3 en fonction de l'angle
-    PulseWidthOC3 = (((pData->AngleSetting +90) * 9000) / 180) + 2999;
+    // Largeur d'impulsion (Pulse Width) de la sortie OC3 : table construite
+    // depuis la calibration du servo (CONV_CalibSet)
+    PulseWidthOC3 = CONV_AngleOc3(pData->AngleSetting);
     PLIB_OC_PulseWidth16BitSet(OC_ID_3, PulseWidthOC3);
 }
  
@@ -305,3 +346,35 @@ void GPWM_ExecPWMSoft(S_pwmSettings *pData)
     }
 }
 
+
+#if ADC_DMA
+// *****************************************************************************
+/* Fonction :
+    void __ISR(_DMA_3_VECTOR, ipl3AUTO) _IntHandlerDmaAdc(void)
+
+  Résumé :
+    Interruption de bloc du canal DMA de l'ADC.
+
+  Description :
+    Chaque bloc complet (demi-buffer ou fin de buffer) est consommé en
+    entier par la chaîne de filtres des 2 canaux pendant que le DMA
+    remplit l'autre bloc.
+
+*/
+// *****************************************************************************
+void __ISR(_DMA_3_VECTOR, ipl3AUTO) _IntHandlerDmaAdc(void)
+{
+    const uint16_t *pBloc;
+
+    ISRP_ENTREE(ISRP_DMA_ADC);
+    // flag effacé avant la boucle : un bloc terminé pendant le
+    // traitement relève le flag et relance l'interruption
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_DMA_3);
+    while ((pBloc = ADCDMA_BlocTermine()) != NULL)
+    {
+        FILTRE_CanalAjouteBloc(&filtre_ADC1, &pBloc[0], ADC_DMA_BLOC_ECH, ADC_DMA_NB_CANAUX);
+        FILTRE_CanalAjouteBloc(&filtre_ADC2, &pBloc[1], ADC_DMA_BLOC_ECH, ADC_DMA_NB_CANAUX);
+    }
+    ISRP_SORTIE(ISRP_DMA_ADC);
+}
+#endif
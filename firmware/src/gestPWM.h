@@ -21,7 +21,15 @@
 /*--------------------------------------------------------*/
 // Définition des fonctions prototypes
 /*--------------------------------------------------------*/
-#define TAILLE_MOYENNE_ADC 10
+// Filtrage ADC : options FILTRE_xxx de Mc32Filtre.h, fixées par -D pour
+// tout le projet (Mc32Filtre.c doit voir les mêmes valeurs)
+//  - lecture à chaque cycle (50 Hz) : chaîne par défaut, moyenne sur 8
+//    (160 ms)
+//  - ADC_DMA (1817 Hz par canal) : -DFILTRE_CIC_ORDRE=2
+//    -DFILTRE_CIC_LOG2_R=5, CIC d'ordre 2 décimant par 32, une sortie
+//    par bloc DMA (57 Hz), puis moyenne sur 8 (141 ms)
+//    Sans ces options (chaîne par défaut), ADC_DMA fonctionne mais la
+//    moyenne sur 8 échantillons ne couvre que ~4 ms de signal
 #define CINQUE 5
 
 typedef struct {
@@ -32,6 +40,7 @@ typedef struct {
 } S_pwmSettings;
 
 void GPWM_Initialize(S_pwmSettings *pData);
+void GPWM_InitADC(void);        // Convertisseur AD et filtres
 
 // Ces 3 fonctions ont pour paramètre un pointeur sur la structure S_pwmSettings.
 void GPWM_GetSettings(S_pwmSettings *pData);	// Obtention vitesse et angle
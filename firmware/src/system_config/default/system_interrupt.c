@@ -62,8 +62,12 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 #include "system/common/sys_common.h"
 #include "app.h"
 #include "system_definitions.h"
+#include "Mc32Profil.h"
 #include <stdint.h>
 
+// Ticks du core timer (SYS_CLK_FREQ / 2) par tick du timer 1 (prescaler 64)
+#define ISRP_TICKS_TMR1 (64 * (SYS_CLK_FREQ / 2) / SYS_CLK_BUS_PERIPHERAL_1)
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: System Interrupt Vector Functions
@@ -87,16 +91,24 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 
   Remarques :
     - APP_UpdateState(APP_STATE_INIT) est appel pendant les 3 premires secondes.
+    - Le compteur du timer repart de 0  l'galit avec la priode : sa
+      valeur  l'entre donne la latence de l'interruption.
 
 */
 // *****************************************************************************
 void __ISR(_TIMER_1_VECTOR, ipl4AUTO) IntHandlerDrvTmrInstance0(void)
 {
+    ISRP_ENTREE(ISRP_TMR1);
+#if ISR_PROFIL
+    ISRP_Latence(ISRP_TMR1, PLIB_TMR_Counter16BitGet(TMR_ID_1) * ISRP_TICKS_TMR1);
+#endif
+
     // Appelle une fonction de rappel timer1
     callback_timer1();
 
     // Efface le drapeau d'interruption du Timer 1
     PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_TIMER_1);
+    ISRP_SORTIE(ISRP_TMR1);
 }
 
 // *****************************************************************************